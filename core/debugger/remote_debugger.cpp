@@ -91,6 +91,46 @@ public:
 	}
 };
 
+class RemoteDebugger::MemoryProfiler : public EngineProfiler {
+	uint64_t last_frame_time = 0;
+	uint64_t last_alloc_count[Memory::TAG_MAX] = {};
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (!p_enable) {
+			return;
+		}
+		last_frame_time = OS::get_singleton()->get_ticks_msec();
+		for (int i = 0; i < Memory::TAG_MAX; i++) {
+			last_alloc_count[i] = Memory::get_tag_alloc_count(Memory::Tag(i));
+		}
+	}
+	void add(const Array &p_data) {}
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		uint64_t time = OS::get_singleton()->get_ticks_msec();
+		if (time - last_frame_time < 1000) {
+			return;
+		}
+		const double elapsed = (time - last_frame_time) / 1000.0;
+		last_frame_time = time;
+
+		// For each tag: its name, live bytes, peak bytes and allocations per second since the last frame.
+		Array arr;
+		arr.resize(Memory::TAG_MAX * 4);
+		for (int i = 0; i < Memory::TAG_MAX; i++) {
+			const Memory::Tag tag = Memory::Tag(i);
+			const uint64_t alloc_count = Memory::get_tag_alloc_count(tag);
+			arr[i * 4 + 0] = Memory::get_tag_name(tag);
+			arr[i * 4 + 1] = Memory::get_tag_usage(tag);
+			arr[i * 4 + 2] = Memory::get_tag_max_usage(tag);
+			arr[i * 4 + 3] = (alloc_count - last_alloc_count[i]) / elapsed;
+			last_alloc_count[i] = alloc_count;
+		}
+
+		EngineDebugger::get_singleton()->send_message("memory:profile_frame", arr);
+	}
+};
+
 Error RemoteDebugger::_put_msg(String p_message, Array p_data) {
 	Array msg;
 	msg.push_back(p_message);
@@ -653,6 +693,10 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 		profiler_enable("performance", true);
 	}
 
+	// Memory Profiler, per tag usage. Only enabled on request, see Memory::Tag.
+	memory_profiler.instantiate();
+	memory_profiler->bind("memory");
+
 	// Core and profiler captures.
 	Capture core_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
@@ -51,8 +51,10 @@ private:
 	typedef DebuggerMarshalls::OutputError ErrorMessage;
 
 	class PerformanceProfiler;
+	class MemoryProfiler;
 
 	Ref<PerformanceProfiler> performance_profiler;
+	Ref<MemoryProfiler> memory_profiler;
 
 	Ref<RemoteDebuggerPeer> peer;
 
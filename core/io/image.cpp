@@ -2495,6 +2495,7 @@ Error Image::load(const String &p_path) {
 		WARN_PRINT("Loaded resource as image file, this will not work on export: '" + p_path + "'. Instead, import the image file as an Image resource and load it normally as a resource.");
 	}
 #endif
+	Memory::TagScope tag_scope(Memory::TAG_TEXTURE);
 	return ImageLoader::load_image(p_path, this);
 }
 
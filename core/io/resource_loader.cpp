@@ -250,6 +250,8 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 	}
 	load_paths_stack->push_back(p_path);
 
+	Memory::TagScope tag_scope(Memory::TAG_RESOURCE);
+
 	// Try all loaders and pick the first match for the type hint
 	bool found = false;
 	Ref<Resource> res;
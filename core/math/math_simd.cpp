@@ -0,0 +1,402 @@
+/**************************************************************************/
+/*  math_simd.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "math_simd.h"
+
+#include "core/math/transform_2d.h"
+#include "core/math/transform_3d.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// The float kernels run on four lanes at a time through the few f32x4
+// helpers below, so each kernel is written once for both instruction sets.
+// The scalar templates finish the tail and handle the doubles.
+// Values repeating every 1, 2 or 3 components are spread over three
+// registers, as 12 components always hold a whole number of them.
+
+#if defined(MATH_SIMD_SSE2)
+#define MATH_SIMD_F32X4
+typedef __m128 f32x4;
+static _FORCE_INLINE_ f32x4 f32x4_load(const float *p_src) { return _mm_loadu_ps(p_src); }
+static _FORCE_INLINE_ void f32x4_store(float *r_dst, f32x4 p_v) { _mm_storeu_ps(r_dst, p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_splat(float p_v) { return _mm_set1_ps(p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_add(f32x4 p_a, f32x4 p_b) { return _mm_add_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_sub(f32x4 p_a, f32x4 p_b) { return _mm_sub_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_mul(f32x4 p_a, f32x4 p_b) { return _mm_mul_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_min(f32x4 p_a, f32x4 p_b) { return _mm_min_ps(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_max(f32x4 p_a, f32x4 p_b) { return _mm_max_ps(p_a, p_b); }
+// Lanes moved up by one or two, shifting in zeros.
+static _FORCE_INLINE_ f32x4 f32x4_shift1(f32x4 p_v) { return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(p_v), 4)); }
+static _FORCE_INLINE_ f32x4 f32x4_shift2(f32x4 p_v) { return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(p_v), 8)); }
+static _FORCE_INLINE_ f32x4 f32x4_splat_last(f32x4 p_v) { return _mm_shuffle_ps(p_v, p_v, _MM_SHUFFLE(3, 3, 3, 3)); }
+static _FORCE_INLINE_ void f32x4_store3(float *r_dst, f32x4 p_v) {
+	_mm_storel_pi((__m64 *)r_dst, p_v);
+	_mm_store_ss(r_dst + 2, _mm_shuffle_ps(p_v, p_v, _MM_SHUFFLE(2, 2, 2, 2)));
+}
+#elif defined(MATH_SIMD_NEON)
+#define MATH_SIMD_F32X4
+typedef float32x4_t f32x4;
+static _FORCE_INLINE_ f32x4 f32x4_load(const float *p_src) { return vld1q_f32(p_src); }
+static _FORCE_INLINE_ void f32x4_store(float *r_dst, f32x4 p_v) { vst1q_f32(r_dst, p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_splat(float p_v) { return vdupq_n_f32(p_v); }
+static _FORCE_INLINE_ f32x4 f32x4_add(f32x4 p_a, f32x4 p_b) { return vaddq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_sub(f32x4 p_a, f32x4 p_b) { return vsubq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_mul(f32x4 p_a, f32x4 p_b) { return vmulq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_min(f32x4 p_a, f32x4 p_b) { return vminq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_max(f32x4 p_a, f32x4 p_b) { return vmaxq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f32x4 f32x4_shift1(f32x4 p_v) { return vextq_f32(vdupq_n_f32(0), p_v, 3); }
+static _FORCE_INLINE_ f32x4 f32x4_shift2(f32x4 p_v) { return vextq_f32(vdupq_n_f32(0), p_v, 2); }
+static _FORCE_INLINE_ f32x4 f32x4_splat_last(f32x4 p_v) { return vdupq_laneq_f32(p_v, 3); }
+static _FORCE_INLINE_ void f32x4_store3(float *r_dst, f32x4 p_v) {
+	vst1_f32(r_dst, vget_low_f32(p_v));
+	vst1q_lane_f32(r_dst + 2, p_v, 2);
+}
+#endif
+
+#ifdef MATH_SIMD_F32X4
+static _FORCE_INLINE_ void _load_repeated(const float *p_value, int p_width, f32x4 *r_v) {
+	float repeated[12];
+	for (int i = 0; i < 12; i++) {
+		repeated[i] = p_value[i % p_width];
+	}
+	for (int i = 0; i < 3; i++) {
+		r_v[i] = f32x4_load(repeated + i * 4);
+	}
+}
+#endif
+
+// The scalar operations mirror the lanes, min and max return the second operand on NaN.
+struct _MathSIMDAdd {
+	template <class T>
+	static _FORCE_INLINE_ T scalar(T p_a, T p_b) { return p_a + p_b; }
+#ifdef MATH_SIMD_F32X4
+	static _FORCE_INLINE_ f32x4 lanes(f32x4 p_a, f32x4 p_b) { return f32x4_add(p_a, p_b); }
+#endif
+	template <class T>
+	static _FORCE_INLINE_ T identity() { return 0; }
+};
+
+struct _MathSIMDMultiply {
+	template <class T>
+	static _FORCE_INLINE_ T scalar(T p_a, T p_b) { return p_a * p_b; }
+#ifdef MATH_SIMD_F32X4
+	static _FORCE_INLINE_ f32x4 lanes(f32x4 p_a, f32x4 p_b) { return f32x4_mul(p_a, p_b); }
+#endif
+};
+
+struct _MathSIMDMin {
+	template <class T>
+	static _FORCE_INLINE_ T scalar(T p_a, T p_b) { return p_a < p_b ? p_a : p_b; }
+#ifdef MATH_SIMD_F32X4
+	static _FORCE_INLINE_ f32x4 lanes(f32x4 p_a, f32x4 p_b) { return f32x4_min(p_a, p_b); }
+#endif
+	template <class T>
+	static _FORCE_INLINE_ T identity() { return INFINITY; }
+};
+
+struct _MathSIMDMax {
+	template <class T>
+	static _FORCE_INLINE_ T scalar(T p_a, T p_b) { return p_a > p_b ? p_a : p_b; }
+#ifdef MATH_SIMD_F32X4
+	static _FORCE_INLINE_ f32x4 lanes(f32x4 p_a, f32x4 p_b) { return f32x4_max(p_a, p_b); }
+#endif
+	template <class T>
+	static _FORCE_INLINE_ T identity() { return -INFINITY; }
+};
+
+template <class Op, class T>
+static _FORCE_INLINE_ void _apply_repeated(T *p_data, int64_t p_from, int64_t p_count, const T *p_value, int p_width) {
+	// p_from is a multiple of 12, so it starts a repetition.
+	for (int64_t i = p_from; i < p_count; i++) {
+		p_data[i] = Op::scalar(p_data[i], p_value[i % p_width]);
+	}
+}
+
+template <class Op>
+static _FORCE_INLINE_ void _apply_repeated(float *p_data, int64_t p_count, const float *p_value, int p_width) {
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	f32x4 v[3];
+	_load_repeated(p_value, p_width, v);
+	for (; i + 12 <= p_count; i += 12) {
+		for (int j = 0; j < 3; j++) {
+			f32x4_store(p_data + i + j * 4, Op::lanes(f32x4_load(p_data + i + j * 4), v[j]));
+		}
+	}
+#endif
+	_apply_repeated<Op>(p_data, i, p_count, p_value, p_width);
+}
+
+template <class Op, class T>
+static _FORCE_INLINE_ void _apply_array(T *p_data, const T *p_other, int64_t p_from, int64_t p_count) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		p_data[i] = Op::scalar(p_data[i], p_other[i]);
+	}
+}
+
+template <class Op>
+static _FORCE_INLINE_ void _apply_array(float *p_data, const float *p_other, int64_t p_count) {
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	for (; i + 4 <= p_count; i += 4) {
+		f32x4_store(p_data + i, Op::lanes(f32x4_load(p_data + i), f32x4_load(p_other + i)));
+	}
+#endif
+	_apply_array<Op>(p_data, p_other, i, p_count);
+}
+
+template <class Op, class T>
+static _FORCE_INLINE_ void _reduce(const T *p_data, int64_t p_from, int64_t p_count, int p_width, T *r_result) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		r_result[i % p_width] = Op::scalar(r_result[i % p_width], p_data[i]);
+	}
+}
+
+template <class Op>
+static _FORCE_INLINE_ void _reduce(const float *p_data, int64_t p_count, int p_width, float *r_result) {
+	for (int i = 0; i < p_width; i++) {
+		r_result[i] = Op::template identity<float>();
+	}
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	if (p_count >= 12) {
+		f32x4 acc[3];
+		for (int j = 0; j < 3; j++) {
+			acc[j] = f32x4_splat(Op::template identity<float>());
+		}
+		for (; i + 12 <= p_count; i += 12) {
+			for (int j = 0; j < 3; j++) {
+				acc[j] = Op::lanes(acc[j], f32x4_load(p_data + i + j * 4));
+			}
+		}
+		float lanes[12];
+		for (int j = 0; j < 3; j++) {
+			f32x4_store(lanes + j * 4, acc[j]);
+		}
+		_reduce<Op>(lanes, 0, 12, p_width, r_result);
+	}
+#endif
+	_reduce<Op>(p_data, i, p_count, p_width, r_result);
+}
+
+template <class Op>
+static _FORCE_INLINE_ void _reduce(const double *p_data, int64_t p_count, int p_width, double *r_result) {
+	for (int i = 0; i < p_width; i++) {
+		r_result[i] = Op::template identity<double>();
+	}
+	_reduce<Op>(p_data, 0, p_count, p_width, r_result);
+}
+
+void MathSIMD::add(float *p_data, int64_t p_count, const float *p_value, int p_width) {
+	_apply_repeated<_MathSIMDAdd>(p_data, p_count, p_value, p_width);
+}
+
+void MathSIMD::add(double *p_data, int64_t p_count, const double *p_value, int p_width) {
+	_apply_repeated<_MathSIMDAdd>(p_data, 0, p_count, p_value, p_width);
+}
+
+void MathSIMD::multiply(float *p_data, int64_t p_count, const float *p_value, int p_width) {
+	_apply_repeated<_MathSIMDMultiply>(p_data, p_count, p_value, p_width);
+}
+
+void MathSIMD::multiply(double *p_data, int64_t p_count, const double *p_value, int p_width) {
+	_apply_repeated<_MathSIMDMultiply>(p_data, 0, p_count, p_value, p_width);
+}
+
+template <class T>
+static _FORCE_INLINE_ void _clamp(T *p_data, int64_t p_from, int64_t p_count, const T *p_min, const T *p_max, int p_width) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		p_data[i] = _MathSIMDMin::scalar(_MathSIMDMax::scalar(p_data[i], p_min[i % p_width]), p_max[i % p_width]);
+	}
+}
+
+void MathSIMD::clamp(float *p_data, int64_t p_count, const float *p_min, const float *p_max, int p_width) {
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	f32x4 lo[3];
+	f32x4 hi[3];
+	_load_repeated(p_min, p_width, lo);
+	_load_repeated(p_max, p_width, hi);
+	for (; i + 12 <= p_count; i += 12) {
+		for (int j = 0; j < 3; j++) {
+			f32x4_store(p_data + i + j * 4, f32x4_min(f32x4_max(f32x4_load(p_data + i + j * 4), lo[j]), hi[j]));
+		}
+	}
+#endif
+	_clamp(p_data, i, p_count, p_min, p_max, p_width);
+}
+
+void MathSIMD::clamp(double *p_data, int64_t p_count, const double *p_min, const double *p_max, int p_width) {
+	_clamp(p_data, 0, p_count, p_min, p_max, p_width);
+}
+
+void MathSIMD::add_array(float *p_data, const float *p_other, int64_t p_count) {
+	_apply_array<_MathSIMDAdd>(p_data, p_other, p_count);
+}
+
+void MathSIMD::add_array(double *p_data, const double *p_other, int64_t p_count) {
+	_apply_array<_MathSIMDAdd>(p_data, p_other, 0, p_count);
+}
+
+void MathSIMD::multiply_array(float *p_data, const float *p_other, int64_t p_count) {
+	_apply_array<_MathSIMDMultiply>(p_data, p_other, p_count);
+}
+
+void MathSIMD::multiply_array(double *p_data, const double *p_other, int64_t p_count) {
+	_apply_array<_MathSIMDMultiply>(p_data, p_other, 0, p_count);
+}
+
+template <class T>
+static _FORCE_INLINE_ void _lerp_array(T *p_data, const T *p_to, int64_t p_from, int64_t p_count, T p_weight) {
+	for (int64_t i = p_from; i < p_count; i++) {
+		p_data[i] = p_data[i] + (p_to[i] - p_data[i]) * p_weight;
+	}
+}
+
+void MathSIMD::lerp_array(float *p_data, const float *p_to, int64_t p_count, float p_weight) {
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	const f32x4 weight = f32x4_splat(p_weight);
+	for (; i + 4 <= p_count; i += 4) {
+		const f32x4 from = f32x4_load(p_data + i);
+		f32x4_store(p_data + i, f32x4_add(from, f32x4_mul(f32x4_sub(f32x4_load(p_to + i), from), weight)));
+	}
+#endif
+	_lerp_array(p_data, p_to, i, p_count, p_weight);
+}
+
+void MathSIMD::lerp_array(double *p_data, const double *p_to, int64_t p_count, double p_weight) {
+	_lerp_array(p_data, p_to, 0, p_count, p_weight);
+}
+
+void MathSIMD::sum(const float *p_data, int64_t p_count, int p_width, float *r_result) {
+	_reduce<_MathSIMDAdd>(p_data, p_count, p_width, r_result);
+}
+
+void MathSIMD::sum(const double *p_data, int64_t p_count, int p_width, double *r_result) {
+	_reduce<_MathSIMDAdd>(p_data, p_count, p_width, r_result);
+}
+
+void MathSIMD::min(const float *p_data, int64_t p_count, int p_width, float *r_result) {
+	_reduce<_MathSIMDMin>(p_data, p_count, p_width, r_result);
+}
+
+void MathSIMD::min(const double *p_data, int64_t p_count, int p_width, double *r_result) {
+	_reduce<_MathSIMDMin>(p_data, p_count, p_width, r_result);
+}
+
+void MathSIMD::max(const float *p_data, int64_t p_count, int p_width, float *r_result) {
+	_reduce<_MathSIMDMax>(p_data, p_count, p_width, r_result);
+}
+
+void MathSIMD::max(const double *p_data, int64_t p_count, int p_width, double *r_result) {
+	_reduce<_MathSIMDMax>(p_data, p_count, p_width, r_result);
+}
+
+float MathSIMD::dot(const float *p_a, const float *p_b, int64_t p_count) {
+	float result = 0;
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	if (p_count >= 4) {
+		f32x4 acc = f32x4_splat(0);
+		for (; i + 4 <= p_count; i += 4) {
+			acc = f32x4_add(acc, f32x4_mul(f32x4_load(p_a + i), f32x4_load(p_b + i)));
+		}
+		float lanes[4];
+		f32x4_store(lanes, acc);
+		result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+	}
+#endif
+	for (; i < p_count; i++) {
+		result += p_a[i] * p_b[i];
+	}
+	return result;
+}
+
+void MathSIMD::prefix_sum(float *p_data, int64_t p_count) {
+	int64_t i = 0;
+#ifdef MATH_SIMD_F32X4
+	f32x4 carry = f32x4_splat(0);
+	for (; i + 4 <= p_count; i += 4) {
+		// Scan within the lanes in two steps, then add what came before.
+		f32x4 v = f32x4_load(p_data + i);
+		v = f32x4_add(v, f32x4_shift1(v));
+		v = f32x4_add(v, f32x4_shift2(v));
+		v = f32x4_add(v, carry);
+		f32x4_store(p_data + i, v);
+		carry = f32x4_splat_last(v);
+	}
+#endif
+	for (; i < p_count; i++) {
+		if (i > 0) {
+			p_data[i] += p_data[i - 1];
+		}
+	}
+}
+
+void MathSIMD::transform(const Vector3 *p_src, Vector3 *r_dst, int64_t p_count, const Transform3D &p_xform) {
+	int64_t i = 0;
+#if defined(MATH_SIMD_F32X4) && !defined(REAL_T_IS_DOUBLE)
+	// Each point is the sum of the basis columns scaled by its coordinates.
+	const Basis &b = p_xform.basis;
+	const float columns[4][4] = {
+		{ b.rows[0].x, b.rows[1].x, b.rows[2].x, 0 },
+		{ b.rows[0].y, b.rows[1].y, b.rows[2].y, 0 },
+		{ b.rows[0].z, b.rows[1].z, b.rows[2].z, 0 },
+		{ p_xform.origin.x, p_xform.origin.y, p_xform.origin.z, 0 },
+	};
+	const f32x4 column_x = f32x4_load(columns[0]);
+	const f32x4 column_y = f32x4_load(columns[1]);
+	const f32x4 column_z = f32x4_load(columns[2]);
+	const f32x4 origin = f32x4_load(columns[3]);
+	for (; i < p_count; i++) {
+		const Vector3 &v = p_src[i];
+		f32x4 r = f32x4_add(f32x4_mul(column_x, f32x4_splat(v.x)), f32x4_mul(column_y, f32x4_splat(v.y)));
+		r = f32x4_add(f32x4_add(r, f32x4_mul(column_z, f32x4_splat(v.z))), origin);
+		f32x4_store3(&r_dst[i].x, r);
+	}
+#endif
+	for (; i < p_count; i++) {
+		r_dst[i] = p_xform.xform(p_src[i]);
+	}
+}
+
+void MathSIMD::transform(const Vector2 *p_src, Vector2 *r_dst, int64_t p_count, const Transform2D &p_xform) {
+	// Two components per point leave little to gain over the plain loop, which compilers vectorize well.
+	for (int64_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_xform.xform(p_src[i]);
+	}
+}
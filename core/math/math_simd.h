@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*  math_simd.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef MATH_SIMD_H
+#define MATH_SIMD_H
+
+#include "core/math/math_defs.h"
+#include "core/typedefs.h"
+
+struct Transform2D;
+struct Transform3D;
+struct Vector2;
+struct Vector3;
+
+// Vectorized kernels for bulk math on packed arrays. Like StringSIMD they are
+// selected at compile time, SSE2 on x86_64 and NEON on arm64, and the float
+// kernels fall back to scalar loops elsewhere. The double overloads, used for
+// vectors with real_t as double, are scalar.
+// Vector arrays are handled as flat arrays of components. Sums are
+// accumulated in several lanes, so they can differ from a sequential sum in
+// the last bits.
+class MathSIMD {
+public:
+	// Operations with a value of p_width (1 to 3) components, repeated over the p_count components of p_data.
+	static void add(float *p_data, int64_t p_count, const float *p_value, int p_width);
+	static void add(double *p_data, int64_t p_count, const double *p_value, int p_width);
+	static void multiply(float *p_data, int64_t p_count, const float *p_value, int p_width);
+	static void multiply(double *p_data, int64_t p_count, const double *p_value, int p_width);
+	static void clamp(float *p_data, int64_t p_count, const float *p_min, const float *p_max, int p_width);
+	static void clamp(double *p_data, int64_t p_count, const double *p_min, const double *p_max, int p_width);
+
+	// Component-wise operations with another array of p_count components.
+	static void add_array(float *p_data, const float *p_other, int64_t p_count);
+	static void add_array(double *p_data, const double *p_other, int64_t p_count);
+	static void multiply_array(float *p_data, const float *p_other, int64_t p_count);
+	static void multiply_array(double *p_data, const double *p_other, int64_t p_count);
+	static void lerp_array(float *p_data, const float *p_to, int64_t p_count, float p_weight);
+	static void lerp_array(double *p_data, const double *p_to, int64_t p_count, double p_weight);
+
+	// Reductions to p_width components written to r_result. p_count is a
+	// non-zero multiple of p_width.
+	static void sum(const float *p_data, int64_t p_count, int p_width, float *r_result);
+	static void sum(const double *p_data, int64_t p_count, int p_width, double *r_result);
+	static void min(const float *p_data, int64_t p_count, int p_width, float *r_result);
+	static void min(const double *p_data, int64_t p_count, int p_width, double *r_result);
+	static void max(const float *p_data, int64_t p_count, int p_width, float *r_result);
+	static void max(const double *p_data, int64_t p_count, int p_width, double *r_result);
+
+	static float dot(const float *p_a, const float *p_b, int64_t p_count);
+	// Inclusive running sum, in place.
+	static void prefix_sum(float *p_data, int64_t p_count);
+
+	// p_src and r_dst may be the same array.
+	static void transform(const Vector3 *p_src, Vector3 *r_dst, int64_t p_count, const Transform3D &p_xform);
+	static void transform(const Vector2 *p_src, Vector2 *r_dst, int64_t p_count, const Transform2D &p_xform);
+};
+
+#endif // MATH_SIMD_H
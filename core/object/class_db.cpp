@@ -346,6 +346,7 @@ Object *ClassDB::instantiate(const StringName &p_class) {
 		return nullptr;
 	}
 #endif
+	Memory::TagScope tag_scope(Memory::TAG_OBJECT);
 	if (ti->gdextension && ti->gdextension->create_instance) {
 		return (Object *)ti->gdextension->create_instance(ti->gdextension->class_userdata);
 	} else {
@@ -1285,6 +1286,26 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		// Constants, methods and signals shadow inherited properties in get_property().
+		if (check->constant_map.has(p_property) || check->method_map.has(p_property) || check->signal_map.has(p_property)) {
+			return nullptr;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -34,6 +34,7 @@
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
 
 #ifdef DEV_ENABLED
 // Includes sanity checks to ensure that a queue set as a thread singleton override
@@ -58,12 +59,157 @@
 	}
 
 void CallQueue::_add_page() {
-	if (pages_used == page_bytes.size()) {
-		pages.push_back(allocator->alloc());
-		page_bytes.push_back(0);
+	// Must be called with the mutex locked.
+	if (pages_allocated == page_table_capacity) {
+		uint32_t new_capacity = MAX(8u, page_table_capacity * 2);
+		Page **new_table = (Page **)memalloc(sizeof(Page *) * new_capacity);
+		Page **old_table = page_table.load(std::memory_order_relaxed);
+		if (old_table) {
+			memcpy(new_table, old_table, sizeof(Page *) * pages_allocated);
+			retired_page_tables.push_back(old_table);
+		}
+		page_table_capacity = new_capacity;
+		page_table.store(new_table, std::memory_order_release);
+	}
+
+	Page *page = allocator->alloc(); // Constructing it clears the ready flags.
+	// Nobody reads this entry until write_state points to it, so it can be set in place.
+	page_table.load(std::memory_order_relaxed)[pages_allocated] = page;
+	pages_allocated++;
+	page_bytes.push_back(0);
+}
+
+uint8_t *CallQueue::_reserve(uint32_t p_room_needed, SafeFlag *&r_ready) {
+	while (true) {
+		uint64_t state = write_state.load(std::memory_order_acquire);
+		uint32_t page = state >> 32;
+		uint32_t offset = state & 0xFFFFFFFF;
+
+		Page **table = page_table.load(std::memory_order_acquire);
+		if (likely(table && offset + p_room_needed <= uint32_t(PAGE_SIZE_BYTES))) {
+			if (write_state.compare_exchange_weak(state, state + p_room_needed, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+				r_ready = &_get_ready_flag(table[page], offset);
+				return &table[page]->data[offset];
+			}
+			continue;
+		}
+
+		// No room in the current page (or no page at all yet).
+		LOCK_MUTEX;
+
+		if (pages_allocated == 0) {
+			_add_page();
+			UNLOCK_MUTEX;
+			continue;
+		}
+
+		state = write_state.load(std::memory_order_acquire);
+		page = state >> 32;
+		offset = state & 0xFFFFFFFF;
+		if (offset + p_room_needed <= uint32_t(PAGE_SIZE_BYTES)) {
+			// Someone else moved to a new page (or the queue was flushed) meanwhile.
+			UNLOCK_MUTEX;
+			continue;
+		}
+
+		if (page + 1 == max_pages) {
+			UNLOCK_MUTEX;
+			return nullptr;
+		}
+		if (page + 1 == pages_allocated) {
+			_add_page();
+		}
+
+		// Leave the page behind, reserving room at the start of the next one in the same operation.
+		page_bytes[page] = offset;
+		uint64_t new_state = (uint64_t(page + 1) << 32) | p_room_needed;
+		bool moved = write_state.compare_exchange_strong(state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed);
+		Page *next_page = page_table.load(std::memory_order_relaxed)[page + 1];
+
+		UNLOCK_MUTEX;
+
+		if (moved) {
+			r_ready = &_get_ready_flag(next_page, 0);
+			return next_page->data;
+		}
+		// More room in the page was reserved meanwhile, try again.
+	}
+}
+
+CallQueue::Message *CallQueue::_get_next_message(uint32_t &r_page, uint32_t &r_offset, uint32_t &r_page_end, bool p_can_reset) {
+	// Only meant for the thread consuming the queue. Returns null once everything pushed so far is consumed,
+	// after resetting the queue to the first page (and r_page, r_offset and r_page_end with it) if p_can_reset is set.
+	while (true) {
+		uint64_t state = write_state.load(std::memory_order_acquire);
+		uint32_t write_page = state >> 32;
+		uint32_t write_offset = state & 0xFFFFFFFF;
+
+		if (r_page == write_page) {
+			if (r_offset < write_offset) {
+				break;
+			}
+			if (!p_can_reset) {
+				return nullptr;
+			}
+			// Start over, unless something is pushed right now.
+			if (write_state.compare_exchange_strong(state, 0, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+				r_page = 0;
+				r_offset = 0;
+				r_page_end = UINT32_MAX;
+				return nullptr;
+			}
+			continue;
+		}
+
+		// A page left behind, so its size is final.
+		if (r_page_end == UINT32_MAX) {
+			LOCK_MUTEX;
+			r_page_end = page_bytes[r_page];
+			UNLOCK_MUTEX;
+		}
+		if (r_offset < r_page_end) {
+			break;
+		}
+		r_page++;
+		r_offset = 0;
+		r_page_end = UINT32_MAX;
+	}
+
+	Page *page = page_table.load(std::memory_order_acquire)[r_page];
+	SafeFlag &ready = _get_ready_flag(page, r_offset);
+	// Room was reserved, but the pusher may still be writing the message. That's quick, so spin for a bit
+	// before yielding, in case the pusher was preempted.
+	for (uint32_t spins = 0; !ready.is_set(); spins++) {
+		if (spins >= 1000) {
+			OS::get_singleton()->yield();
+		}
+	}
+	// The room is only reused once the queue starts over, by then this message is released.
+	ready.clear();
+
+	Message *message = (Message *)&page->data[r_offset];
+
+	// Pre-advance, so consuming is reentrant.
+	r_offset += message->get_size();
+	return message;
+}
+
+void CallQueue::_release_message(Message *p_message) {
+	switch (p_message->type & FLAG_MASK) {
+		case TYPE_NOTIFICATION: {
+		} break;
+		case TYPE_NATIVE: {
+			NativeCallBase *native_call = (NativeCallBase *)(p_message + 1);
+			native_call->~NativeCallBase();
+		} break;
+		default: {
+			Variant *args = (Variant *)(p_message + 1);
+			for (int k = 0; k < p_message->args; k++) {
+				args[k].~Variant();
+			}
+		}
 	}
-	page_bytes[pages_used] = 0;
-	pages_used++;
+	p_message->~Message();
 }
 
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
@@ -87,24 +233,14 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	LOCK_MUTEX;
-
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			ERR_PRINT("Failed method: " + p_callable + ". Message queue out of memory. " + error_text);
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	SafeFlag *ready = nullptr;
+	uint8_t *buffer_end = _reserve(room_needed, ready);
+	if (unlikely(!buffer_end)) {
+		ERR_PRINT("Failed method: " + p_callable + ". Message queue out of memory. " + error_text);
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
@@ -125,37 +261,26 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	ready->set();
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			ERR_PRINT("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id) + ". Message queue out of memory. " + error_text);
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	SafeFlag *ready = nullptr;
+	uint8_t *buffer_end = _reserve(room_needed, ready);
+	if (unlikely(!buffer_end)) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		ERR_PRINT("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id) + ". Message queue out of memory. " + error_text);
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
@@ -166,32 +291,23 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	ready->set();
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			ERR_PRINT("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id) + ". Message queue out of memory. " + error_text);
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	SafeFlag *ready = nullptr;
+	uint8_t *buffer_end = _reserve(room_needed, ready);
+	if (unlikely(!buffer_end)) {
+		ERR_PRINT("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id) + ". Message queue out of memory. " + error_text);
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
@@ -199,8 +315,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	ready->set();
 
 	return OK;
 }
@@ -223,55 +338,58 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 }
 
 Error CallQueue::_transfer_messages_to_main_queue() {
-	if (pages.size() == 0) {
+	if (pages_allocated == 0) {
 		return OK;
 	}
 
 	CallQueue *mq = MessageQueue::main_singleton;
-	DEV_ASSERT(!mq->allocator_is_custom && !allocator_is_custom); // Transferring pages is only safe if using the same alloator parameters.
-
-	mq->mutex.lock();
-
-	// Here we're transferring the data from this queue to the main one.
-	// However, it's very unlikely big amounts of messages will be queued here,
-	// so PagedArray/Pool would be overkill. Also, in most cases the data will fit
-	// an already existing page of the main queue.
-
-	// Let's see if our first (likely only) page fits the current target queue page.
-	uint32_t src_page = 0;
-	{
-		if (mq->pages_used) {
-			uint32_t dst_page = mq->pages_used - 1;
-			uint32_t dst_offset = mq->page_bytes[dst_page];
-			if (dst_offset + page_bytes[0] < uint32_t(PAGE_SIZE_BYTES)) {
-				memcpy(mq->pages[dst_page]->data + dst_offset, pages[0]->data, page_bytes[0]);
-				mq->page_bytes[dst_page] += page_bytes[0];
-				src_page++;
-			}
-		}
-	}
-
-	// Any other possibly existing source page needs to be added.
 
-	if (mq->pages_used + (pages_used - src_page) > mq->max_pages) {
-		ERR_PRINT("Failed appending thread queue. Message queue out of memory. " + mq->error_text);
-		mq->statistics();
-		mq->mutex.unlock();
-		return ERR_OUT_OF_MEMORY;
-	}
+	// Messages are re-pushed one by one, since the main queue may be receiving messages from other threads at the same time.
+	// However, it's very unlikely big amounts of messages will be queued here.
+	Error err = OK;
+	uint32_t page = 0;
+	uint32_t offset = 0;
+	uint32_t page_end = UINT32_MAX;
+	while (Message *message = _get_next_message(page, offset, page_end)) {
+		if (err == OK) {
+			SafeFlag *ready = nullptr;
+			uint8_t *buffer_end = mq->_reserve(message->get_size(), ready);
+			if (buffer_end) {
+				Message *msg = memnew_placement(buffer_end, Message);
+				msg->callable = message->callable;
+				msg->type = message->type;
+				msg->args = message->args; // Also copies the notification or native size, if that's the case.
+
+				switch (message->type & FLAG_MASK) {
+					case TYPE_NOTIFICATION: {
+					} break;
+					case TYPE_NATIVE: {
+						// Native calls can't be copied generically, so they are moved instead. What's left is destroyed on release.
+						NativeCallBase *native_call = (NativeCallBase *)(message + 1);
+						native_call->move_to(buffer_end + sizeof(Message));
+					} break;
+					default: {
+						buffer_end += sizeof(Message);
+						const Variant *args = (const Variant *)(message + 1);
+						for (int i = 0; i < message->args; i++) {
+							Variant *v = memnew_placement(buffer_end, Variant);
+							buffer_end += sizeof(Variant);
+							*v = args[i];
+						}
+					}
+				}
 
-	for (; src_page < pages_used; src_page++) {
-		mq->_add_page();
-		memcpy(mq->pages[mq->pages_used - 1]->data, pages[src_page]->data, page_bytes[src_page]);
-		mq->page_bytes[mq->pages_used - 1] = page_bytes[src_page];
+				ready->set();
+			} else {
+				ERR_PRINT("Failed appending thread queue. Message queue out of memory. " + mq->error_text);
+				mq->statistics();
+				err = ERR_OUT_OF_MEMORY;
+			}
+		}
+		_release_message(message);
 	}
 
-	mq->mutex.unlock();
-
-	page_bytes[0] = 0;
-	pages_used = 1;
-
-	return OK;
+	return err;
 }
 
 Error CallQueue::flush() {
@@ -282,7 +400,7 @@ Error CallQueue::flush() {
 
 	LOCK_MUTEX;
 
-	if (pages.size() == 0) {
+	if (pages_allocated == 0) {
 		// Never allocated
 		UNLOCK_MUTEX;
 		return OK; // Do nothing.
@@ -294,29 +412,15 @@ Error CallQueue::flush() {
 	}
 
 	flushing = true;
+	flush_page = 0;
+	flush_offset = 0;
+	flush_page_end = UINT32_MAX;
+	UNLOCK_MUTEX;
 
-	uint32_t i = 0;
-	uint32_t offset = 0;
-
-	while (i < pages_used && offset < page_bytes[i]) {
-		Page *page = pages[i];
-
-		//lock on each iteration, so a call can re-add itself to the message queue
-
-		Message *message = (Message *)&page->data[offset];
-
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
-
-		//pre-advance so this function is reentrant
-		offset += advance;
-
+	// Messages pushed meanwhile (including by the calls made here) are processed as well.
+	while (Message *message = _get_next_message(flush_page, flush_offset, flush_page_end)) {
 		Object *target = message->callable.get_object();
 
-		UNLOCK_MUTEX;
-
 		switch (message->type & FLAG_MASK) {
 			case TYPE_CALL: {
 				if (target || (message->type & FLAG_NULL_IS_OK)) {
@@ -335,27 +439,19 @@ Error CallQueue::flush() {
 					target->set(message->callable.get_method(), *arg);
 				}
 			} break;
+			case TYPE_NATIVE: {
+				NativeCallBase *native_call = (NativeCallBase *)(message + 1);
+				Object *object = ObjectDB::get_instance(native_call->object);
+				if (object) {
+					native_call->call(object);
+				}
+			} break;
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
-			}
-		}
-
-		message->~Message();
-
-		LOCK_MUTEX;
-		if (offset == page_bytes[i]) {
-			i++;
-			offset = 0;
-		}
+		_release_message(message);
 	}
 
-	page_bytes[0] = 0;
-	pages_used = 1;
-
+	LOCK_MUTEX;
 	flushing = false;
 	UNLOCK_MUTEX;
 	return OK;
@@ -364,42 +460,29 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
-	if (pages.size() == 0) {
+	if (pages_allocated == 0) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
 	}
 
-	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
-		while (offset < page_bytes[i]) {
-			Page *page = pages[i];
-
-			//lock on each iteration, so a call can re-add itself to the message queue
-
-			Message *message = (Message *)&page->data[offset];
-
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
-
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
+	bool was_flushing = flushing;
+	UNLOCK_MUTEX;
 
-			message->~Message();
+	if (was_flushing) {
+		// Called from a deferred call, so this is the consuming thread. Drop the messages flush() didn't get to.
+		// The one being called is left to flush(), and so is starting over, as its room is still in use.
+		while (Message *message = _get_next_message(flush_page, flush_offset, flush_page_end, false)) {
+			_release_message(message);
 		}
+		return;
 	}
 
-	pages_used = 1;
-	page_bytes[0] = 0;
-
-	UNLOCK_MUTEX;
+	uint32_t page = 0;
+	uint32_t offset = 0;
+	uint32_t page_end = UINT32_MAX;
+	while (Message *message = _get_next_message(page, offset, page_end)) {
+		_release_message(message);
+	}
 }
 
 void CallQueue::statistics() {
@@ -407,21 +490,27 @@ void CallQueue::statistics() {
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
+	int native_count = 0;
 	int null_count = 0;
 
-	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
-		while (offset < page_bytes[i]) {
-			Page *page = pages[i];
-
-			//lock on each iteration, so a call can re-add itself to the message queue
+	// This is only meant for diagnostics, so it's fine to just stop at the first message still being written.
+	uint64_t state = write_state.load(std::memory_order_acquire);
+	uint32_t pages_used = pages_allocated ? (state >> 32) + 1 : 0;
+	Page **table = page_table.load(std::memory_order_acquire);
+	bool stop = false;
 
-			Message *message = (Message *)&page->data[offset];
-
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
+	for (uint32_t i = 0; i < pages_used && !stop; i++) {
+		uint32_t offset = 0;
+		uint32_t page_end = (i + 1 == pages_used) ? uint32_t(state & 0xFFFFFFFF) : page_bytes[i];
+		while (offset < page_end) {
+			Page *page = table[i];
+
+			if (!_get_ready_flag(page, offset).is_set()) {
+				// Either still being written, or already consumed by a flush in progress.
+				stop = true;
+				break;
 			}
+			Message *message = (Message *)&page->data[offset];
 
 			Object *target = message->callable.get_object();
 
@@ -458,6 +547,13 @@ void CallQueue::statistics() {
 						null_target = false;
 					}
 				} break;
+				case TYPE_NATIVE: {
+					NativeCallBase *native_call = (NativeCallBase *)(message + 1);
+					if (ObjectDB::get_instance(native_call->object)) {
+						native_count++;
+						null_target = false;
+					}
+				} break;
 			}
 			if (null_target) {
 				//object was deleted
@@ -466,16 +562,7 @@ void CallQueue::statistics() {
 				null_count++;
 			}
 
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
-
-			message->~Message();
+			offset += message->get_size();
 		}
 	}
 
@@ -494,6 +581,8 @@ void CallQueue::statistics() {
 		print_line("NOTIFY " + itos(E.key) + ": " + itos(E.value));
 	}
 
+	print_line("NATIVE CALLS: " + itos(native_count));
+
 	UNLOCK_MUTEX;
 }
 
@@ -502,18 +591,11 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
-	if (pages_used == 0) {
-		return false;
-	}
-	if (pages_used == 1 && page_bytes[0] == 0) {
-		return false;
-	}
-
-	return true;
+	return write_state.load(std::memory_order_acquire) != 0;
 }
 
 int CallQueue::get_max_buffer_usage() const {
-	return pages.size() * PAGE_SIZE_BYTES;
+	return pages_allocated * PAGE_SIZE_BYTES;
 }
 
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
@@ -531,8 +613,15 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 CallQueue::~CallQueue() {
 	clear();
 	// Let go of pages.
-	for (uint32_t i = 0; i < pages.size(); i++) {
-		allocator->free(pages[i]);
+	Page **table = page_table.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < pages_allocated; i++) {
+		allocator->free(table[i]);
+	}
+	if (table) {
+		memfree(table);
+	}
+	for (Page **retired_table : retired_page_tables) {
+		memfree(retired_table);
 	}
 	if (!allocator_is_custom) {
 		memdelete(allocator);
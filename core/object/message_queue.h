@@ -35,8 +35,11 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
+#include <type_traits>
+
 class Object;
 
 class CallQueue {
@@ -44,11 +47,15 @@ class CallQueue {
 
 public:
 	enum {
-		PAGE_SIZE_BYTES = 4096
+		PAGE_SIZE_BYTES = 4096,
+		READY_FLAG_BYTES = 8, // Messages are bigger than this, so no two of them start within the same span.
 	};
 
 	struct Page {
 		uint8_t data[PAGE_SIZE_BYTES];
+		// Whether the message starting in each span of data is fully written. They're kept apart from the messages,
+		// so the consumer never reads a message the pusher is still constructing.
+		SafeFlag ready[PAGE_SIZE_BYTES / READY_FLAG_BYTES];
 	};
 
 	// Needs to be public to be able to define it outside the class.
@@ -60,23 +67,39 @@ private:
 		TYPE_CALL,
 		TYPE_NOTIFICATION,
 		TYPE_SET,
+		TYPE_NATIVE,
 		TYPE_END, // End marker.
 		FLAG_NULL_IS_OK = 1 << 13,
 		FLAG_SHOW_ERROR = 1 << 14,
 		FLAG_MASK = FLAG_NULL_IS_OK - 1,
 	};
 
+	// Pushing is lock-free: room for a message is reserved in the current page by advancing write_state,
+	// then the message is written and marked as ready. The mutex is only needed to move to a new page.
 	Mutex mutex;
 
 	Allocator *allocator = nullptr;
 	bool allocator_is_custom = false;
 
-	LocalVector<Page *> pages;
-	LocalVector<uint32_t> page_bytes;
+	// Index of the page being written in the high 32 bits, bytes reserved in it in the low 32 bits.
+	std::atomic<uint64_t> write_state = { 0 };
+
+	// Pages are kept for reuse until the queue is destroyed, so the table only grows. Pushers read it without
+	// locking, so when it has to be reallocated the old one is kept around (retired) instead of freed.
+	std::atomic<Page **> page_table = { nullptr };
+	uint32_t page_table_capacity = 0;
+	uint32_t pages_allocated = 0;
+	LocalVector<Page **> retired_page_tables;
+
+	LocalVector<uint32_t> page_bytes; // Final size of pages already left behind by write_state. Guarded by the mutex.
 	uint32_t max_pages = 0;
-	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Position of flush() in the queue, so clear() can drop the remaining messages when called from a deferred call.
+	uint32_t flush_page = 0;
+	uint32_t flush_offset = 0;
+	uint32_t flush_page_end = UINT32_MAX;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -87,20 +110,87 @@ private:
 		union {
 			int16_t notification;
 			int16_t args;
+			int16_t native_size;
 		};
-	};
 
-	_FORCE_INLINE_ void _ensure_first_page() {
-		if (unlikely(pages.is_empty())) {
-			pages.push_back(allocator->alloc());
-			page_bytes.push_back(0);
-			pages_used = 1;
+		_FORCE_INLINE_ uint32_t get_size() const {
+			uint32_t size = sizeof(Message);
+			switch (type & FLAG_MASK) {
+				case TYPE_NOTIFICATION: {
+				} break;
+				case TYPE_NATIVE: {
+					size += native_size;
+				} break;
+				default: {
+					size += sizeof(Variant) * args;
+				}
+			}
+			return size;
 		}
+	};
+
+	static_assert(sizeof(Message) > READY_FLAG_BYTES, "Messages must be bigger than the span covered by each ready flag.");
+
+	_FORCE_INLINE_ static SafeFlag &_get_ready_flag(Page *p_page, uint32_t p_offset) {
+		return p_page->ready[p_offset / READY_FLAG_BYTES];
 	}
 
+	// Arguments of native calls, stored by value.
+	template <class... P>
+	struct NativeArgs {
+		template <class T, class M, class... Q>
+		_FORCE_INLINE_ void call(T *p_instance, M p_method, Q &...p_previous) {
+			(p_instance->*p_method)(p_previous...);
+		}
+	};
+
+	template <class P0, class... P>
+	struct NativeArgs<P0, P...> {
+		P0 value;
+		NativeArgs<P...> rest;
+
+		template <class A0, class... A>
+		NativeArgs(const A0 &p_value, const A &...p_rest) :
+				value(p_value), rest(p_rest...) {}
+
+		template <class T, class M, class... Q>
+		_FORCE_INLINE_ void call(T *p_instance, M p_method, Q &...p_previous) {
+			rest.call(p_instance, p_method, p_previous..., value);
+		}
+	};
+
+	// Payload of TYPE_NATIVE messages, placed right after the message.
+	struct NativeCallBase {
+		ObjectID object;
+		virtual void call(Object *p_object) = 0;
+		virtual void move_to(void *p_to) = 0; // Move-constructs the call at p_to, leaving this one to be destroyed.
+		virtual ~NativeCallBase() {}
+	};
+
+	template <class T, class M, class... P>
+	struct NativeCall : public NativeCallBase {
+		M method;
+		NativeArgs<P...> args;
+
+		virtual void call(Object *p_object) override {
+			args.call(static_cast<T *>(p_object), method);
+		}
+
+		virtual void move_to(void *p_to) override {
+			memnew_placement(p_to, NativeCall(std::move(*this)));
+		}
+
+		template <class... A>
+		NativeCall(M p_method, const A &...p_args) :
+				method(p_method), args(p_args...) {}
+	};
+
 	Error _transfer_messages_to_main_queue();
 
 	void _add_page();
+	uint8_t *_reserve(uint32_t p_room_needed, SafeFlag *&r_ready);
+	Message *_get_next_message(uint32_t &r_page, uint32_t &r_offset, uint32_t &r_page_end, bool p_can_reset = true);
+	void _release_message(Message *p_message);
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
@@ -146,6 +236,39 @@ public:
 	Error push_notification(Object *p_object, int p_notification);
 	Error push_set(Object *p_object, const StringName &p_prop, const Variant &p_value);
 
+	// Typed deferred call for engine code. Arguments are stored by value in the queue and the method is called
+	// directly, so there's no Variant conversion, method lookup or allocation. The call is skipped if the object
+	// has been freed by the time the queue is flushed.
+	template <class T, class... P, class... VarArgs>
+	Error push_native(T *p_object, void (T::*p_method)(P...), VarArgs... p_args) {
+		static_assert(sizeof...(P) == sizeof...(VarArgs), "Wrong number of arguments for the method.");
+		typedef NativeCall<T, void (T::*)(P...), std::remove_cv_t<std::remove_reference_t<P>>...> NativeCallT;
+		static_assert(alignof(NativeCallT) <= alignof(Message), "Native call arguments can't be over-aligned.");
+
+		// Keep messages aligned.
+		const uint32_t native_size = (sizeof(NativeCallT) + alignof(Message) - 1) & ~uint32_t(alignof(Message) - 1);
+		static_assert(sizeof(Message) + sizeof(NativeCallT) <= PAGE_SIZE_BYTES, "Native call arguments don't fit in a page.");
+
+		SafeFlag *ready = nullptr;
+		uint8_t *buffer_end = _reserve(sizeof(Message) + native_size, ready);
+		if (unlikely(!buffer_end)) {
+			ERR_PRINT("Failed native call. Message queue out of memory. " + error_text);
+			statistics();
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		Message *msg = memnew_placement(buffer_end, Message);
+		msg->type = TYPE_NATIVE;
+		msg->native_size = native_size;
+
+		NativeCallT *native_call = memnew_placement(buffer_end + sizeof(Message), NativeCallT(p_method, p_args...));
+		native_call->object = p_object->get_instance_id();
+
+		ready->set();
+
+		return OK;
+	}
+
 	Error flush();
 	void clear();
 	void statistics();
@@ -43,18 +43,6 @@
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	Object *obj;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj = p_obj;
-		obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		obj->_lock_index.unref();
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1072,24 +1060,32 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
+	if (s->slot_map.is_empty()) {
+		return OK; // User signal without connections.
+	}
+
 	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
-	{
+	if (s->slot_conns_dirty) {
+		s->slot_conns.resize(s->slot_map.size());
+		Connection *w = s->slot_conns.ptrw();
 		uint32_t idx = 0;
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
+			w[idx++] = slot_kv.value.conn;
 		}
 		DEV_ASSERT(idx == s->slot_map.size());
+		s->slot_conns_dirty = false;
 	}
 
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. This only references the connections,
+	// they are copied if they change during the emission.
+	const Vector<Connection> slot_conns = s->slot_conns;
+
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
@@ -1352,6 +1348,8 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*target.get_base_comparator()] = slot;
+	s->slot_conns.clear();
+	s->slot_conns_dirty = true;
 
 	return OK;
 }
@@ -1408,6 +1406,8 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 
 	target_object->connections.erase(slot->cE);
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->slot_conns.clear();
+	s->slot_conns_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -42,11 +42,52 @@ void WorkerThreadPool::Task::free_template_userdata() {
 
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
+thread_local int WorkerThreadPool::current_thread_index = -1;
+
+void WorkerThreadPool::_add_to_task_queue(SelfList<Task> *p_task_elem) {
+	// Must be called with task_mutex locked.
+	task_queue.add_last(p_task_elem);
+	task_queue_count.increment();
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_take_task() {
+	// The caller has consumed a post of task_available_semaphore, and every task is queued before posting it,
+	// so there is a task available somewhere. It may just take a few attempts to get it if other threads
+	// are competing for the same queues.
+	const int thread_index = current_thread_index;
+	const uint32_t thread_count = threads.size();
+	Task *task = nullptr;
+
+	while (true) {
+		// Own queue first, since those are the most recent tasks posted by this thread (likely cache-hot).
+		if (thread_index != -1 && threads[thread_index].work_queue.pop(task)) {
+			return task;
+		}
+
+		if (task_queue_count.get()) {
+			task_mutex.lock();
+			if (task_queue.first()) {
+				task = task_queue.first()->self();
+				task_queue.remove(task_queue.first());
+				task_queue_count.decrement();
+				task_mutex.unlock();
+				return task;
+			}
+			task_mutex.unlock();
+		}
+
+		// Steal from the other threads, starting from the next one so thieves spread across victims.
+		for (uint32_t i = 1; i <= thread_count; i++) {
+			uint32_t victim = (uint32_t)(thread_index + i) % thread_count;
+			if (threads[victim].work_queue.steal(task)) {
+				return task;
+			}
+		}
+	}
+}
+
 void WorkerThreadPool::_process_task_queue() {
-	task_mutex.lock();
-	Task *task = task_queue.first()->self();
-	task_queue.remove(task_queue.first());
-	task_mutex.unlock();
+	Task *task = _take_task();
 	_process_task(task);
 }
 
@@ -58,7 +99,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	if (!use_native_low_priority_threads) {
 		// Tasks must start with this unset. They are free to set-and-forget otherwise.
 		set_current_thread_safe_for_nodes(false);
-		pool_thread_index = thread_ids[Thread::get_caller_id()];
+		pool_thread_index = current_thread_index;
 		ThreadData &curr_thread = threads[pool_thread_index];
 		task_mutex.lock();
 		p_task->pool_thread_index = pool_thread_index;
@@ -107,16 +148,20 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			memdelete(p_task->template_userdata); // This is no longer needed at this point, so get rid of it.
 		}
 
+		TightLocalVector<Dependent> ready_dependents;
+		if (do_post) {
+			task_mutex.lock();
+			p_task->group->completed.set_to(true);
+			_release_dependents(p_task->group->dependents, ready_dependents);
+			task_mutex.unlock();
+		}
+
 		if (low_priority && use_native_low_priority_threads) {
 			p_task->completed = true;
 			p_task->done_semaphore.post();
-			if (do_post) {
-				p_task->group->completed.set_to(true);
-			}
 		} else {
 			if (do_post) {
 				p_task->group->done_semaphore.post();
-				p_task->group->completed.set_to(true);
 			}
 			uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 			uint32_t finished_users = p_task->group->finished.increment();
@@ -134,6 +179,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			task_allocator.free(p_task);
 			task_mutex.unlock();
 		}
+
+		_post_dependents(ready_dependents);
 	} else {
 		if (p_task->native_func) {
 			p_task->native_func(p_task->native_func_userdata);
@@ -146,6 +193,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.callp(nullptr, 0, ret, ce);
 		}
 
+		TightLocalVector<Dependent> ready_dependents;
 		task_mutex.lock();
 		p_task->completed = true;
 		for (uint8_t i = 0; i < p_task->waiting; i++) {
@@ -154,7 +202,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (!use_native_low_priority_threads) {
 			p_task->pool_thread_index = -1;
 		}
+		_release_dependents(p_task->dependents, ready_dependents);
 		task_mutex.unlock(); // Keep mutex down to here since on unlock the task may be freed.
+
+		_post_dependents(ready_dependents);
 	}
 
 	// Task may have been freed by now (all callers notified).
@@ -185,6 +236,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
+	current_thread_index = ((ThreadData *)p_user)->index;
 	while (true) {
 		singleton->task_available_semaphore.wait();
 		if (singleton->exit_threads) {
@@ -209,8 +261,19 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 		return;
 	}
 
-	task_mutex.lock();
 	p_task->low_priority = !p_high_priority;
+
+	if (p_high_priority && current_thread_index != -1) {
+		// Posted from a pool thread (e.g., a task spawning subtasks or a group): keep it local, without locking.
+		// Idle threads will steal it if this one is busy.
+		if (threads[current_thread_index].work_queue.push(p_task)) {
+			task_available_semaphore.post();
+			return;
+		}
+		// Own queue is full, fall back to the shared one.
+	}
+
+	task_mutex.lock();
 	if (!p_high_priority && use_native_low_priority_threads) {
 		p_task->low_priority_thread = native_thread_allocator.alloc();
 		task_mutex.unlock();
@@ -220,7 +283,7 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 		}
 		p_task->low_priority_thread->start(_native_low_priority_thread_function, p_task); // Pask task directly to thread.
 	} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-		task_queue.add_last(&p_task->task_elem);
+		_add_to_task_queue(&p_task->task_elem);
 		if (!p_high_priority) {
 			low_priority_threads_used++;
 		}
@@ -233,11 +296,75 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 	}
 }
 
+bool WorkerThreadPool::_add_dependent(int64_t p_id, const Dependent &p_dependent) {
+	// Must be called with task_mutex locked.
+	// Returns whether the task or group with the given ID is still to be completed, in which case
+	// it will release the dependent when done. Unknown IDs are assumed to belong to already awaited tasks/groups.
+	Task **taskp = tasks.getptr(p_id);
+	if (taskp) {
+		if ((*taskp)->completed) {
+			return false;
+		}
+		(*taskp)->dependents.push_back(p_dependent);
+		return true;
+	}
+
+	Group **groupp = groups.getptr(p_id);
+	if (groupp) {
+		if ((*groupp)->completed.is_set()) {
+			return false;
+		}
+		(*groupp)->dependents.push_back(p_dependent);
+		return true;
+	}
+
+	return false;
+}
+
+void WorkerThreadPool::_release_dependents(TightLocalVector<Dependent> &p_dependents, TightLocalVector<Dependent> &r_ready) {
+	// Must be called with task_mutex locked. Ready dependents are to be posted by the caller after unlocking.
+	for (const Dependent &dependent : p_dependents) {
+		uint32_t &pending = dependent.task ? dependent.task->pending_dependencies : dependent.group->pending_dependencies;
+		pending--;
+		if (pending == 0) {
+			r_ready.push_back(dependent);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_dependents(const TightLocalVector<Dependent> &p_ready) {
+	for (const Dependent &dependent : p_ready) {
+		if (dependent.task) {
+			_post_task(dependent.task, !dependent.task->low_priority);
+		} else {
+			// Nobody else touches the pending tasks anymore, but copy them since the group can be freed once the last one is done.
+			Group *group = dependent.group;
+			uint32_t task_count = group->pending_tasks.size();
+			Task **group_tasks = (Task **)alloca(sizeof(Task *) * task_count);
+			memcpy(group_tasks, group->pending_tasks.ptr(), sizeof(Task *) * task_count);
+			group->pending_tasks.clear();
+			_post_group_tasks(group, group_tasks, task_count, group->pending_high_priority);
+		}
+	}
+}
+
+void WorkerThreadPool::_post_group_tasks(Group *p_group, Task **p_tasks, uint32_t p_task_count, bool p_high_priority) {
+	bool uses_native_threads = p_group->uses_native_threads;
+	for (uint32_t i = 0; i < p_task_count; i++) {
+		_post_task(p_tasks[i], p_high_priority);
+	}
+	if (uses_native_threads) {
+		// Let the awaiter know all the threads have been started, so it can join them.
+		p_group->done_semaphore.post();
+	}
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
 		low_priority_task_queue.remove(low_priority_task_queue.first());
-		task_queue.add_last(&low_prio_task->task_elem);
+		_add_to_task_queue(&low_prio_task->task_elem);
 		low_priority_threads_used++;
 		return true;
 	} else {
@@ -255,7 +382,7 @@ void WorkerThreadPool::_prevent_low_prio_saturation_deadlock() {
 		SelfList<Task> *to_promote = low_priority_task_queue.first();
 		if (to_promote) {
 			low_priority_task_queue.remove(to_promote);
-			task_queue.add_last(to_promote);
+			_add_to_task_queue(to_promote);
 			low_priority_threads_used++;
 			task_available_semaphore.post();
 		}
@@ -266,7 +393,7 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -276,10 +403,23 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
+
+	Dependent dependent;
+	dependent.task = task;
+	for (int64_t dependency : p_dependencies) {
+		if (_add_dependent(dependency, dependent)) {
+			task->pending_dependencies++;
+		}
+	}
+	bool ready = task->pending_dependencies == 0;
+
 	tasks.insert(id, task);
 	task_mutex.unlock();
 
-	_post_task(task, p_high_priority);
+	if (ready) {
+		_post_task(task, p_high_priority);
+	}
 
 	return id;
 }
@@ -288,6 +428,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const Vector<int64_t> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_task_with_dependencies(const Callable &p_action, const Vector<int64_t> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	task_mutex.lock();
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -302,6 +450,40 @@ bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	return completed;
 }
 
+void WorkerThreadPool::_wait_collaboratively(Semaphore &p_done_semaphore, bool p_low_priority) {
+	// We are an actual process thread, we must not be blocked so continue processing stuff if available.
+	// This also runs (or steals) what the awaited task or group posted to this thread's own queue.
+	bool must_exit = false;
+	while (true) {
+		if (p_done_semaphore.try_wait()) {
+			// If done, exit
+			break;
+		}
+		if (!must_exit) {
+			if (task_available_semaphore.try_wait()) {
+				if (exit_threads) {
+					must_exit = true;
+				} else {
+					// Solve tasks while they are around.
+					bool safe_for_nodes_backup = is_current_thread_safe_for_nodes();
+					_process_task_queue();
+					set_current_thread_safe_for_nodes(safe_for_nodes_backup);
+					continue;
+				}
+			} else if (!use_native_low_priority_threads && p_low_priority) {
+				// A low prioriry task started waiting, so see if we can move a pending one to the high priority queue.
+				task_mutex.lock();
+				bool post = _try_promote_low_priority_task();
+				task_mutex.unlock();
+				if (post) {
+					task_available_semaphore.post();
+				}
+			}
+		}
+		OS::get_singleton()->delay_usec(1); // Microsleep, this could be converted to waiting for multiple objects in supported platforms for a bit more performance.
+	}
+}
+
 Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	task_mutex.lock();
 	Task **taskp = tasks.getptr(p_task_id);
@@ -313,8 +495,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 
 	if (!task->completed) {
 		if (!use_native_low_priority_threads && task->pool_thread_index != -1) { // Otherwise, it's not running yet.
-			int caller_pool_th_index = thread_ids.has(Thread::get_caller_id()) ? thread_ids[Thread::get_caller_id()] : -1;
-			if (caller_pool_th_index == task->pool_thread_index) {
+			if (current_thread_index == task->pool_thread_index) {
 				// Deadlock prevention.
 				// Waiting for a task run on this same thread? That means the task to be awaited started waiting as well
 				// and another task was run to make use of the thread in the meantime, with enough bad luck as to
@@ -339,7 +520,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 			// or when there are too few worker threads (limited platforms or exotic settings). If that turns out to be
 			// an issue in the real world, a further fix can be applied against that.
 			if (task->low_priority) {
-				bool awaiter_is_a_low_prio_task = thread_ids.has(Thread::get_caller_id()) && threads[thread_ids[Thread::get_caller_id()]].current_low_prio_task;
+				bool awaiter_is_a_low_prio_task = current_thread_index != -1 && threads[current_thread_index].current_low_prio_task;
 				if (awaiter_is_a_low_prio_task) {
 					is_low_prio_waiting_for_another = true;
 					low_priority_tasks_awaiting_others++;
@@ -355,38 +536,9 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 		if (use_native_low_priority_threads && task->low_priority) {
 			task->done_semaphore.wait();
 		} else {
-			bool current_is_pool_thread = thread_ids.has(Thread::get_caller_id());
+			bool current_is_pool_thread = current_thread_index != -1;
 			if (current_is_pool_thread) {
-				// We are an actual process thread, we must not be blocked so continue processing stuff if available.
-				bool must_exit = false;
-				while (true) {
-					if (task->done_semaphore.try_wait()) {
-						// If done, exit
-						break;
-					}
-					if (!must_exit) {
-						if (task_available_semaphore.try_wait()) {
-							if (exit_threads) {
-								must_exit = true;
-							} else {
-								// Solve tasks while they are around.
-								bool safe_for_nodes_backup = is_current_thread_safe_for_nodes();
-								_process_task_queue();
-								set_current_thread_safe_for_nodes(safe_for_nodes_backup);
-								continue;
-							}
-						} else if (!use_native_low_priority_threads && task->low_priority) {
-							// A low prioriry task started waiting, so see if we can move a pending one to the high priority queue.
-							task_mutex.lock();
-							bool post = _try_promote_low_priority_task();
-							task_mutex.unlock();
-							if (post) {
-								task_available_semaphore.post();
-							}
-						}
-					}
-					OS::get_singleton()->delay_usec(1); // Microsleep, this could be converted to waiting for multiple objects in supported platforms for a bit more performance.
-				}
+				_wait_collaboratively(task->done_semaphore, task->low_priority);
 			} else {
 				task->done_semaphore.wait();
 			}
@@ -413,7 +565,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	return OK;
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
@@ -428,6 +580,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 	Task **tasks_posted = nullptr;
 	if (p_elements == 0) {
 		// Should really not call it with zero Elements, but at least it should work.
+		// Dependencies are ignored in this case, since there's nothing to run after them.
 		group->completed.set_to(true);
 		group->done_semaphore.post();
 		group->tasks_used = 0;
@@ -447,16 +600,34 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
 			tasks_posted[i] = task;
 			// No task ID is used.
 		}
+		group->uses_native_threads = !p_high_priority && use_native_low_priority_threads;
+
+		Dependent dependent;
+		dependent.group = group;
+		for (int64_t dependency : p_dependencies) {
+			if (_add_dependent(dependency, dependent)) {
+				group->pending_dependencies++;
+			}
+		}
+		if (group->pending_dependencies > 0) {
+			// Will be posted when the last dependency is completed.
+			group->pending_high_priority = p_high_priority;
+			for (int i = 0; i < p_tasks; i++) {
+				group->pending_tasks.push_back(tasks_posted[i]);
+			}
+			p_tasks = 0;
+		}
 	}
 
 	groups[id] = group;
 	task_mutex.unlock();
 
-	for (int i = 0; i < p_tasks; i++) {
-		_post_task(tasks_posted[i], p_high_priority);
+	if (p_tasks > 0) {
+		_post_group_tasks(group, tasks_posted, p_tasks, p_high_priority);
 	}
 
 	return id;
@@ -470,6 +641,14 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
 }
 
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
 	task_mutex.lock();
 	const Group *const *groupp = groups.getptr(p_group);
@@ -502,7 +681,10 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	}
 	Group *group = *groupp;
 
-	if (group->low_priority_native_tasks.size() > 0) {
+	if (group->uses_native_threads) {
+		// Posted once all the threads are started, which may be later than now if the group has dependencies.
+		group->done_semaphore.wait();
+
 		for (Task *task : group->low_priority_native_tasks) {
 			task->low_priority_thread->wait_to_finish();
 			task_mutex.lock();
@@ -512,10 +694,21 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 		}
 
 		task_mutex.lock();
+		groups.erase(p_group);
 		group_allocator.free(group);
 		task_mutex.unlock();
 	} else {
-		group->done_semaphore.wait();
+		if (current_thread_index != -1) {
+			// Waiting from a pool thread, its own queue may hold the group tasks, so help until they're done.
+			_wait_collaboratively(group->done_semaphore, false);
+		} else {
+			group->done_semaphore.wait();
+		}
+
+		// Remove it before it can be freed, so it's not found when adding dependencies.
+		task_mutex.lock(); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
+		groups.erase(p_group);
+		task_mutex.unlock();
 
 		uint32_t max_users = group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = group->finished.increment(); // fetch happens before inc, so increment later.
@@ -527,10 +720,6 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 			task_mutex.unlock();
 		}
 	}
-
-	task_mutex.lock(); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
-	groups.erase(p_group);
-	task_mutex.unlock();
 }
 
 void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_priority, float p_low_priority_task_ratio) {
@@ -552,7 +741,6 @@ void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_pr
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
-		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
 }
 
@@ -587,7 +775,10 @@ void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
+	ClassDB::bind_method(D_METHOD("add_task_with_dependencies", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_task_with_dependencies, DEFVAL(false), DEFVAL(String()));
+
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_group_task_with_dependencies", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task_with_dependencies, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
@@ -39,6 +39,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -52,6 +53,7 @@ public:
 
 private:
 	struct Task;
+	struct Group;
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
@@ -59,6 +61,12 @@ private:
 		virtual ~BaseTemplateUserdata() {}
 	};
 
+	// Something to schedule once all the tasks/groups it depends on are completed.
+	struct Dependent {
+		Task *task = nullptr;
+		Group *group = nullptr;
+	};
+
 	struct Group {
 		GroupID self;
 		SafeNumeric<uint32_t> index;
@@ -69,6 +77,12 @@ private:
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
 		TightLocalVector<Task *> low_priority_native_tasks;
+		TightLocalVector<Dependent> dependents;
+		// While there are unfinished dependencies, the tasks of the group are kept here instead of being posted.
+		uint32_t pending_dependencies = 0;
+		TightLocalVector<Task *> pending_tasks;
+		bool pending_high_priority = false;
+		bool uses_native_threads = false; // Run by native low priority threads, instead of pool ones.
 	};
 
 	struct Task {
@@ -86,6 +100,8 @@ private:
 		BaseTemplateUserdata *template_userdata = nullptr;
 		Thread *low_priority_thread = nullptr;
 		int pool_thread_index = -1;
+		TightLocalVector<Dependent> dependents;
+		uint32_t pending_dependencies = 0; // The task is not posted until this drops to zero.
 
 		void free_template_userdata();
 		Task() :
@@ -97,7 +113,8 @@ private:
 	PagedAllocator<Thread> native_thread_allocator;
 
 	SelfList<Task>::List low_priority_task_queue;
-	SelfList<Task>::List task_queue;
+	SelfList<Task>::List task_queue; // Shared queue, for tasks posted from outside the pool or not fitting a thread's own queue.
+	SafeNumeric<uint32_t> task_queue_count; // Allows checking for queued tasks without locking.
 
 	Mutex task_mutex;
 	Semaphore task_available_semaphore;
@@ -106,12 +123,14 @@ private:
 		uint32_t index;
 		Thread thread;
 		Task *current_low_prio_task = nullptr;
+		// High priority tasks posted from this thread. Other threads steal from it when out of work.
+		WorkStealingDeque<Task *> work_queue;
 	};
 
 	TightLocalVector<ThreadData> threads;
 	bool exit_threads = false;
 
-	HashMap<Thread::ID, int> thread_ids;
+	static thread_local int current_thread_index; // -1 if the caller is not a pool thread.
 	HashMap<TaskID, Task *> tasks;
 	HashMap<GroupID, Group *> groups;
 
@@ -126,18 +145,26 @@ private:
 	static void _thread_function(void *p_user);
 	static void _native_low_priority_thread_function(void *p_user);
 
+	void _add_to_task_queue(SelfList<Task> *p_task_elem);
+	Task *_take_task();
 	void _process_task_queue();
+	void _wait_collaboratively(Semaphore &p_done_semaphore, bool p_low_priority);
 	void _process_task(Task *task);
 
 	void _post_task(Task *p_task, bool p_high_priority);
 
+	bool _add_dependent(int64_t p_id, const Dependent &p_dependent);
+	void _release_dependents(TightLocalVector<Dependent> &p_dependents, TightLocalVector<Dependent> &r_ready);
+	void _post_dependents(const TightLocalVector<Dependent> &p_ready);
+	void _post_group_tasks(Group *p_group, Task **p_tasks, uint32_t p_task_count, bool p_high_priority);
+
 	bool _try_promote_low_priority_task();
 	void _prevent_low_prio_saturation_deadlock();
 
 	static WorkerThreadPool *singleton;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies = Vector<int64_t>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies = Vector<int64_t>());
 
 	template <class C, class M, class U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -159,6 +186,50 @@ private:
 		}
 	};
 
+	template <class C, class M, class U>
+	struct ParallelForUserData {
+		C *instance;
+		M method;
+		U userdata;
+		uint32_t elements = 0;
+		uint32_t min_chunk = 1;
+		uint32_t slots = 1;
+		std::atomic<uint32_t> next = { 0 };
+
+		static void process(void *p_userdata, uint32_t p_slot) {
+			ParallelForUserData *ud = (ParallelForUserData *)p_userdata;
+			uint32_t from = ud->next.load(std::memory_order_relaxed);
+			while (from < ud->elements) {
+				// Guided scheduling: big chunks first, smaller ones as the remaining work shrinks, so
+				// threads finish at about the same time without paying an atomic operation per element.
+				uint32_t remaining = ud->elements - from;
+				uint32_t chunk = MIN(remaining, MAX(ud->min_chunk, remaining / (ud->slots * 2)));
+				if (ud->next.compare_exchange_weak(from, from + chunk, std::memory_order_relaxed)) {
+					(ud->instance->*ud->method)(from, from + chunk, p_slot, ud->userdata);
+					from = ud->next.load(std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+	template <class T>
+	struct ParallelAccumulator {
+		T value;
+		uint8_t padding[64 - (sizeof(T) % 64)]; // Avoid false sharing between slots.
+	};
+
+	template <class T, class C, class M, class U>
+	struct ParallelReduceUserData {
+		C *instance;
+		M method;
+		U userdata;
+		LocalVector<ParallelAccumulator<T>> accumulators;
+
+		void process_range(uint32_t p_from, uint32_t p_to, uint32_t p_slot, void *p_unused) {
+			(instance->*method)(p_from, p_to, accumulators[p_slot].value, userdata);
+		}
+	};
+
 protected:
 	static void _bind_methods();
 
@@ -175,6 +246,20 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Variants taking the IDs of tasks and/or groups that must be completed before this one is scheduled.
+	// IDs that are no longer valid (e.g., already awaited) are considered completed.
+	template <class C, class M, class U>
+	TaskID add_template_task_with_dependencies(C *p_instance, M p_method, U p_userdata, const Vector<int64_t> &p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
+	}
+	TaskID add_native_task_with_dependencies(void (*p_func)(void *), void *p_userdata, const Vector<int64_t> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_task_with_dependencies(const Callable &p_action, const Vector<int64_t> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -189,11 +274,74 @@ public:
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <class C, class M, class U>
+	GroupID add_template_group_task_with_dependencies(C *p_instance, M p_method, U p_userdata, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description, p_dependencies);
+	}
+	GroupID add_native_group_task_with_dependencies(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_group_task_with_dependencies(const Callable &p_action, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Calls (p_instance->*p_method)(from, to, slot, p_userdata) on consecutive ranges covering [0, p_elements),
+	// from all the worker threads, and returns when all of them are processed. Ranges are never smaller than
+	// p_min_chunk elements (except the last one). The slot is lower than get_parallel_slot_count() and is never
+	// used by two calls at the same time, so it can index per-thread data without locking.
+	template <class C, class M, class U>
+	void parallel_for(C *p_instance, M p_method, U p_userdata, uint32_t p_elements, uint32_t p_min_chunk = 1, const String &p_description = String()) {
+		if (p_elements == 0) {
+			return;
+		}
+		if (threads.size() == 0 || p_elements <= p_min_chunk) {
+			(p_instance->*p_method)(0, p_elements, 0, p_userdata);
+			return;
+		}
+
+		typedef ParallelForUserData<C, M, U> ParallelForUD;
+		ParallelForUD ud;
+		ud.instance = p_instance;
+		ud.method = p_method;
+		ud.userdata = p_userdata;
+		ud.elements = p_elements;
+		ud.min_chunk = MAX(1u, p_min_chunk);
+		ud.slots = get_parallel_slot_count();
+		GroupID group = _add_group_task(Callable(), &ParallelForUD::process, &ud, nullptr, ud.slots, ud.slots, true, p_description);
+		wait_for_group_task_completion(group);
+	}
+
+	// Like parallel_for(), but each slot has its own accumulator, starting as a copy of p_identity:
+	// (p_instance->*p_method)(from, to, T &r_accumulator, p_userdata). Once done, accumulators are merged
+	// in slot order into a copy of p_identity, which is returned: (p_instance->*p_merge)(T &r_into, const T &p_accumulator).
+	template <class T, class C, class M, class MM, class U>
+	T parallel_reduce(C *p_instance, M p_method, MM p_merge, U p_userdata, uint32_t p_elements, const T &p_identity, uint32_t p_min_chunk = 1, const String &p_description = String()) {
+		typedef ParallelReduceUserData<T, C, M, U> ParallelReduceUD;
+		ParallelReduceUD ud;
+		ud.instance = p_instance;
+		ud.method = p_method;
+		ud.userdata = p_userdata;
+		ud.accumulators.resize(get_parallel_slot_count());
+		for (ParallelAccumulator<T> &accumulator : ud.accumulators) {
+			accumulator.value = p_identity;
+		}
+
+		parallel_for(&ud, &ParallelReduceUD::process_range, (void *)nullptr, p_elements, p_min_chunk, p_description);
+
+		T result = p_identity;
+		for (const ParallelAccumulator<T> &accumulator : ud.accumulators) {
+			(p_instance->*p_merge)(result, accumulator.value);
+		}
+		return result;
+	}
+
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
+	_FORCE_INLINE_ uint32_t get_parallel_slot_count() const { return MAX(1u, threads.size()); }
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	void init(int p_thread_count = -1, bool p_use_native_threads_low_priority = true, float p_low_priority_task_ratio = 0.3);
@@ -0,0 +1,286 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+#include <string.h>
+#include <atomic>
+
+namespace {
+
+struct Chunk {
+	Chunk *next;
+	size_t size;
+	std::atomic<uint32_t> alive; // Allocations not freed yet, possibly freed by other threads.
+};
+
+// Keeps the allocations aligned.
+constexpr size_t CHUNK_HEADER_SIZE = (sizeof(Chunk) + FrameArena::ALIGN - 1) & ~size_t(FrameArena::ALIGN - 1);
+
+// Precedes every allocation.
+struct AllocHeader {
+	Chunk *chunk;
+	uint32_t size; // To copy it when reallocating.
+	uint32_t frame; // To only count the bytes of the current frame.
+};
+
+constexpr size_t ALLOC_HEADER_SIZE = (sizeof(AllocHeader) + FrameArena::ALIGN - 1) & ~size_t(FrameArena::ALIGN - 1);
+
+_FORCE_INLINE_ size_t _align(size_t p_bytes) {
+	return (p_bytes + FrameArena::ALIGN - 1) & ~size_t(FrameArena::ALIGN - 1);
+}
+
+// Trivially constructible and destructible, so it's usable at any point of the thread lifetime.
+struct ThreadArena {
+	Chunk *chunks; // In use, the first one is being allocated from.
+	Chunk *free_chunks; // Reclaimed, ready to be reused.
+	uint8_t *pos;
+	uint8_t *end;
+	uint8_t *last; // Last allocation, which can be resized in place.
+	uint64_t frame;
+	bool initialized;
+};
+
+thread_local ThreadArena thread_arena;
+
+void _release_chunks(Chunk *p_chunk, bool p_only_unused) {
+	while (p_chunk) {
+		Chunk *next = p_chunk->next;
+		if (!p_only_unused || p_chunk->alive.load(std::memory_order_acquire) == 0) {
+			Memory::free_static(p_chunk);
+		}
+		p_chunk = next;
+	}
+}
+
+// Frees the chunks when the thread exits.
+struct ThreadArenaGuard {
+	bool active = false;
+
+	~ThreadArenaGuard() {
+		if (active) {
+			// Allocations still alive are an error, but at least don't free the memory under them.
+			_release_chunks(thread_arena.chunks, true);
+			_release_chunks(thread_arena.free_chunks, false);
+			thread_arena.chunks = nullptr;
+			thread_arena.free_chunks = nullptr;
+			thread_arena.pos = nullptr;
+			thread_arena.end = nullptr;
+			thread_arena.last = nullptr;
+		}
+	}
+};
+
+thread_local ThreadArenaGuard thread_arena_guard;
+
+// Takes back the chunks without allocations alive, so a long-lived allocation only keeps its own chunk.
+void _reclaim(ThreadArena &r_arena) {
+	if (!r_arena.initialized) {
+		r_arena.initialized = true;
+		thread_arena_guard.active = true;
+	}
+
+	Chunk *current = r_arena.chunks;
+	Chunk **prev = &r_arena.chunks;
+	Chunk *chunk = r_arena.chunks;
+	while (chunk) {
+		Chunk *next = chunk->next;
+		if (chunk->alive.load(std::memory_order_acquire) == 0) {
+			if (chunk == current) {
+				r_arena.pos = nullptr;
+				r_arena.end = nullptr;
+				r_arena.last = nullptr;
+			}
+			*prev = next;
+			// Oversized chunks are freed, regular ones are kept for later.
+			if (chunk->size == FrameArena::CHUNK_SIZE) {
+				chunk->next = r_arena.free_chunks;
+				r_arena.free_chunks = chunk;
+			} else {
+				Memory::free_static(chunk);
+			}
+		} else {
+			prev = &chunk->next;
+		}
+		chunk = next;
+	}
+}
+
+Chunk *_add_chunk(ThreadArena &r_arena, size_t p_bytes) {
+	// Threads that don't follow the main loop frames only reclaim memory here.
+	_reclaim(r_arena);
+
+	Chunk *chunk = nullptr;
+	if (p_bytes <= FrameArena::CHUNK_SIZE - CHUNK_HEADER_SIZE && r_arena.free_chunks) {
+		chunk = r_arena.free_chunks;
+		r_arena.free_chunks = chunk->next;
+	}
+	if (!chunk) {
+		const size_t size = MAX((size_t)FrameArena::CHUNK_SIZE, p_bytes + CHUNK_HEADER_SIZE);
+		chunk = (Chunk *)Memory::alloc_static(size);
+		ERR_FAIL_NULL_V(chunk, nullptr);
+		chunk->size = size;
+		chunk->alive.store(0, std::memory_order_relaxed);
+	}
+
+	if (chunk->size != FrameArena::CHUNK_SIZE && r_arena.chunks) {
+		// Oversized, keep allocating from the current chunk afterwards.
+		chunk->next = r_arena.chunks->next;
+		r_arena.chunks->next = chunk;
+		return chunk;
+	}
+
+	chunk->next = r_arena.chunks;
+	r_arena.chunks = chunk;
+	r_arena.pos = (uint8_t *)chunk + CHUNK_HEADER_SIZE;
+	r_arena.end = (uint8_t *)chunk + chunk->size;
+	r_arena.last = nullptr;
+	return chunk;
+}
+
+_FORCE_INLINE_ AllocHeader *_get_header(void *p_ptr) {
+	return (AllocHeader *)((uint8_t *)p_ptr - ALLOC_HEADER_SIZE);
+}
+
+} // namespace
+
+SafeNumeric<uint64_t> FrameArena::frame;
+SafeNumeric<uint64_t> FrameArena::frame_bytes;
+SafeNumeric<uint64_t> FrameArena::frame_allocations;
+uint64_t FrameArena::last_frame_bytes = 0;
+uint64_t FrameArena::last_frame_allocations = 0;
+
+void *FrameArena::alloc(size_t p_bytes) {
+	ERR_FAIL_COND_V_MSG(p_bytes > UINT32_MAX, nullptr, "Allocation too big for the frame arena.");
+
+	ThreadArena &arena = thread_arena;
+	const uint64_t current_frame = frame.get();
+	if (unlikely(arena.frame != current_frame || !arena.initialized)) {
+		// Reclaim the memory of the previous frames that is no longer in use.
+		_reclaim(arena);
+		arena.frame = current_frame;
+	}
+
+	const size_t size = ALLOC_HEADER_SIZE + _align(p_bytes);
+	uint8_t *mem = nullptr;
+	Chunk *chunk = arena.chunks;
+	if (likely((size_t)(arena.end - arena.pos) >= size)) {
+		mem = arena.pos + ALLOC_HEADER_SIZE;
+		arena.pos += size;
+		arena.last = mem;
+	} else {
+		chunk = _add_chunk(arena, size);
+		if (!chunk) {
+			return nullptr;
+		}
+		if (chunk == arena.chunks) {
+			mem = arena.pos + ALLOC_HEADER_SIZE;
+			arena.pos += size;
+			arena.last = mem;
+		} else {
+			// Oversized chunks hold a single allocation.
+			mem = (uint8_t *)chunk + CHUNK_HEADER_SIZE + ALLOC_HEADER_SIZE;
+		}
+	}
+
+	AllocHeader *header = _get_header(mem);
+	header->chunk = chunk;
+	header->size = (uint32_t)p_bytes;
+	header->frame = (uint32_t)current_frame;
+	chunk->alive.fetch_add(1, std::memory_order_relaxed);
+
+	frame_bytes.add(p_bytes);
+	frame_allocations.increment();
+	return mem;
+}
+
+void *FrameArena::realloc(void *p_ptr, size_t p_bytes) {
+	if (p_ptr == nullptr) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_ptr);
+		return nullptr;
+	}
+	ERR_FAIL_COND_V_MSG(p_bytes > UINT32_MAX, nullptr, "Allocation too big for the frame arena.");
+
+	AllocHeader *header = _get_header(p_ptr);
+	const size_t old_bytes = header->size;
+	ThreadArena &arena = thread_arena;
+	if (p_ptr == arena.last) {
+		// Resize the last allocation in place if it still fits in the chunk.
+		uint8_t *new_pos = (uint8_t *)p_ptr + _align(p_bytes);
+		if (new_pos <= arena.end) {
+			arena.pos = new_pos;
+			header->size = (uint32_t)p_bytes;
+			if (p_bytes > old_bytes) {
+				frame_bytes.add(p_bytes - old_bytes);
+			} else if (header->frame == (uint32_t)frame.get()) {
+				// Only what was counted during this frame can be taken back.
+				frame_bytes.sub(old_bytes - p_bytes);
+			}
+			return p_ptr;
+		}
+	}
+
+	void *mem = alloc(p_bytes);
+	if (mem) {
+		memcpy(mem, p_ptr, MIN(old_bytes, p_bytes));
+		free(p_ptr);
+	}
+	return mem;
+}
+
+void FrameArena::free(void *p_ptr) {
+	ERR_FAIL_NULL(p_ptr);
+
+	ThreadArena &arena = thread_arena;
+	if (p_ptr == arena.last) {
+		// Only the last allocation can be given back right away.
+		arena.pos = (uint8_t *)p_ptr - ALLOC_HEADER_SIZE;
+		arena.last = nullptr;
+	}
+
+	Chunk *chunk = _get_header(p_ptr)->chunk;
+	if (chunk->alive.fetch_sub(1, std::memory_order_acq_rel) == 1 && chunk == arena.chunks) {
+		// The first chunk of this thread is no longer used, so allocate from its start again.
+		arena.pos = (uint8_t *)chunk + CHUNK_HEADER_SIZE;
+		arena.end = (uint8_t *)chunk + chunk->size;
+		arena.last = nullptr;
+	}
+}
+
+void FrameArena::end_frame() {
+	last_frame_bytes = frame_bytes.get();
+	last_frame_allocations = frame_allocations.get();
+	frame_bytes.set(0);
+	frame_allocations.set(0);
+	frame.increment();
+}
@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+// Linear allocator for transient data, such as per-frame containers rebuilt every frame.
+//
+// Each thread bumps a pointer in its own chunks, so allocating doesn't lock.
+// Allocations must still be freed, but that only gives back the memory of the
+// last allocation of the thread, which is also the only one that can grow in place.
+// The rest is reclaimed by chunk, once none of the allocations in it are alive:
+// after the main loop ends the frame, or when the thread needs a new chunk.
+// Keeping an allocation alive for longer than a frame is valid, but keeps its chunk
+// from being reused. Allocations must be freed before the thread which made them exits.
+
+class FrameArena {
+	static SafeNumeric<uint64_t> frame;
+	static SafeNumeric<uint64_t> frame_bytes;
+	static SafeNumeric<uint64_t> frame_allocations;
+	static uint64_t last_frame_bytes;
+	static uint64_t last_frame_allocations;
+
+public:
+	static constexpr uint32_t ALIGN = 16;
+	static constexpr uint32_t CHUNK_SIZE = 256 * 1024;
+
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_ptr, size_t p_bytes);
+	static void free(void *p_ptr);
+
+	// Called by the main loop after each frame.
+	static void end_frame();
+
+	// Bytes (and allocations) served by the arena instead of the heap during the last frame.
+	static uint64_t get_frame_bytes() { return last_frame_bytes; }
+	static uint64_t get_frame_allocations() { return last_frame_allocations; }
+};
+
+// For LocalVector, List, RBMap and other containers taking an allocator.
+class FrameAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return FrameArena::alloc(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return FrameArena::realloc(p_ptr, p_memory); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { FrameArena::free(p_ptr); }
+};
+
+// For HashMap, HashSet and other containers taking a typed allocator.
+template <class T>
+class FrameTypedAllocator {
+public:
+	template <class... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(FrameArena::alloc(sizeof(T)), T(p_args...)); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) {
+		p_allocation->~T();
+		FrameArena::free(p_allocation);
+	}
+};
+
+template <class T, class U = uint32_t, bool force_trivial = false, bool tight = false>
+using FrameLocalVector = LocalVector<T, U, force_trivial, tight, FrameAllocator>;
+
+#endif // FRAME_ARENA_H
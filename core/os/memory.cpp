@@ -33,8 +33,13 @@
 #include "core/error/error_macros.h"
 #include "core/templates/safe_refcount.h"
 
+#ifdef SMALL_ALLOCATOR_ENABLED
+#include "core/os/small_allocator.h"
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -44,6 +49,10 @@ void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)) {
 	return p_allocfunc(p_size);
 }
 
+void *operator new(size_t p_size, const Memory::TagScope &p_tag_scope) {
+	return Memory::alloc_static(p_size, false);
+}
+
 #ifdef _MSC_VER
 void operator delete(void *p_mem, const char *p_description) {
 	CRASH_NOW_MSG("Call to placement delete should not happen.");
@@ -53,6 +62,10 @@ void operator delete(void *p_mem, void *(*p_allocfunc)(size_t p_size)) {
 	CRASH_NOW_MSG("Call to placement delete should not happen.");
 }
 
+void operator delete(void *p_mem, const Memory::TagScope &p_tag_scope) {
+	CRASH_NOW_MSG("Call to placement delete should not happen.");
+}
+
 void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_description) {
 	CRASH_NOW_MSG("Call to placement delete should not happen.");
 }
@@ -61,18 +74,79 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+
+SafeNumeric<uint64_t> Memory::tag_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_max_usage[TAG_MAX];
+SafeNumeric<uint64_t> Memory::tag_alloc_count[TAG_MAX];
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_DEFAULT;
+
+// The tag of an allocation is kept in the top byte of the size stored in its padding.
+#define MEMORY_TAG_SHIFT 56
+
+_FORCE_INLINE_ static uint64_t _header_size(uint64_t p_header) {
+	return p_header & ((uint64_t(1) << MEMORY_TAG_SHIFT) - 1);
+}
+
+_FORCE_INLINE_ static Memory::Tag _header_tag(uint64_t p_header) {
+	return Memory::Tag(p_header >> MEMORY_TAG_SHIFT);
+}
+
+_FORCE_INLINE_ static uint64_t _make_header(uint64_t p_bytes, Memory::Tag p_tag) {
+	return p_bytes | (uint64_t(p_tag) << MEMORY_TAG_SHIFT);
+}
+#else
+_FORCE_INLINE_ static uint64_t _header_size(uint64_t p_header) {
+	return p_header;
+}
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+#ifdef SMALL_ALLOCATOR_ENABLED
+// The small allocator needs the size of the allocation to free it, so every allocation is prepadded.
+_FORCE_INLINE_ static void *_sys_malloc(size_t p_bytes) {
+	return SmallAllocator::is_small(p_bytes) ? SmallAllocator::alloc(p_bytes) : malloc(p_bytes);
+}
+
+_FORCE_INLINE_ static void _sys_free(void *p_mem, size_t p_bytes) {
+	if (SmallAllocator::is_small(p_bytes)) {
+		SmallAllocator::free(p_mem, p_bytes);
+	} else {
+		free(p_mem);
+	}
+}
+
+static void *_sys_realloc(void *p_mem, size_t p_old_bytes, size_t p_bytes) {
+	const bool old_small = SmallAllocator::is_small(p_old_bytes);
+	const bool small = SmallAllocator::is_small(p_bytes);
+	if (!old_small && !small) {
+		return realloc(p_mem, p_bytes);
+	}
+	if (old_small && small && SmallAllocator::get_size_class(p_old_bytes) == SmallAllocator::get_size_class(p_bytes)) {
+		return p_mem;
+	}
+
+	void *mem = _sys_malloc(p_bytes);
+	if (mem) {
+		memcpy(mem, p_mem, MIN(p_old_bytes, p_bytes));
+		_sys_free(p_mem, p_old_bytes);
+	}
+	return mem;
+}
+#endif
+
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_ALLOCATOR_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
 #endif
 
+#ifdef SMALL_ALLOCATOR_ENABLED
+	void *mem = _sys_malloc(p_bytes + PAD_ALIGN);
+#else
 	void *mem = malloc(p_bytes + (prepad ? PAD_ALIGN : 0));
+#endif
 
 	ERR_FAIL_COND_V(!mem, nullptr);
 
@@ -80,13 +154,20 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	if (prepad) {
 		uint64_t *s = (uint64_t *)mem;
+#ifdef DEBUG_ENABLED
+		const Tag tag = current_tag;
+		*s = _make_header(p_bytes, tag);
+#else
 		*s = p_bytes;
+#endif
 
 		uint8_t *s8 = (uint8_t *)mem;
 
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+		tag_max_usage[tag].exchange_if_greater(tag_usage[tag].add(p_bytes));
+		tag_alloc_count[tag].increment();
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -94,6 +175,11 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	}
 }
 
+void *Memory::alloc_tagged(size_t p_bytes, Tag p_tag, bool p_pad_align) {
+	TagScope tag_scope(p_tag);
+	return alloc_static(p_bytes, p_pad_align);
+}
+
 void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (p_memory == nullptr) {
 		return alloc_static(p_bytes, p_pad_align);
@@ -101,7 +187,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_ALLOCATOR_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -110,28 +196,44 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= PAD_ALIGN;
 		uint64_t *s = (uint64_t *)mem;
+#if defined(DEBUG_ENABLED) || defined(SMALL_ALLOCATOR_ENABLED)
+		const uint64_t old_bytes = _header_size(*s);
+#endif
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+		const Tag tag = _header_tag(*s);
+		if (p_bytes > old_bytes) {
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_bytes);
 			max_usage.exchange_if_greater(new_mem_usage);
+			tag_max_usage[tag].exchange_if_greater(tag_usage[tag].add(p_bytes - old_bytes));
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(old_bytes - p_bytes);
+			tag_usage[tag].sub(old_bytes - p_bytes);
 		}
 #endif
 
 		if (p_bytes == 0) {
+#ifdef SMALL_ALLOCATOR_ENABLED
+			_sys_free(mem, old_bytes + PAD_ALIGN);
+#else
 			free(mem);
+#endif
 			return nullptr;
 		} else {
-			*s = p_bytes;
-
+#ifdef SMALL_ALLOCATOR_ENABLED
+			mem = (uint8_t *)_sys_realloc(mem, old_bytes + PAD_ALIGN, p_bytes + PAD_ALIGN);
+#else
 			mem = (uint8_t *)realloc(mem, p_bytes + PAD_ALIGN);
+#endif
 			ERR_FAIL_COND_V(!mem, nullptr);
 
 			s = (uint64_t *)mem;
 
+#ifdef DEBUG_ENABLED
+			*s = _make_header(p_bytes, tag);
+#else
 			*s = p_bytes;
+#endif
 
 			return mem + PAD_ALIGN;
 		}
@@ -149,7 +251,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_ALLOCATOR_ENABLED)
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -160,12 +262,19 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	if (prepad) {
 		mem -= PAD_ALIGN;
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(SMALL_ALLOCATOR_ENABLED)
 		uint64_t *s = (uint64_t *)mem;
-		mem_usage.sub(*s);
+#endif
+#ifdef DEBUG_ENABLED
+		mem_usage.sub(_header_size(*s));
+		tag_usage[_header_tag(*s)].sub(_header_size(*s));
 #endif
 
+#ifdef SMALL_ALLOCATOR_ENABLED
+		_sys_free(mem, _header_size(*s) + PAD_ALIGN);
+#else
 		free(mem);
+#endif
 	} else {
 		free(mem);
 	}
@@ -191,6 +300,46 @@ uint64_t Memory::get_mem_max_usage() {
 #endif
 }
 
+const char *Memory::get_tag_name(Tag p_tag) {
+	static const char *names[TAG_MAX] = {
+		"default",
+		"object",
+		"resource",
+		"texture",
+		"script",
+		"navigation",
+	};
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, "");
+	return names[p_tag];
+}
+
+uint64_t Memory::get_tag_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_max_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_max_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_alloc_count(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef DEBUG_ENABLED
+	return tag_alloc_count[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -43,31 +43,86 @@
 #endif
 
 class Memory {
+public:
+	// Subsystems that allocations can be attributed to, with TagScope or memnew_tagged().
+	// Only tracked in debug builds, where each allocation has room to store its tag.
+	enum Tag {
+		TAG_DEFAULT,
+		TAG_OBJECT,
+		TAG_RESOURCE,
+		TAG_TEXTURE,
+		TAG_SCRIPT,
+		TAG_NAVIGATION,
+		TAG_MAX,
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+
+	static SafeNumeric<uint64_t> tag_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_max_usage[TAG_MAX];
+	static SafeNumeric<uint64_t> tag_alloc_count[TAG_MAX];
+	static thread_local Tag current_tag;
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
 
 public:
+	// Attributes the allocations made by the current thread while it's alive to a tag.
+	// Scopes nest, the innermost one wins.
+	class TagScope {
+#ifdef DEBUG_ENABLED
+		Tag previous_tag;
+
+	public:
+		_FORCE_INLINE_ TagScope(Tag p_tag) {
+			previous_tag = current_tag;
+			current_tag = p_tag;
+		}
+		_FORCE_INLINE_ ~TagScope() { current_tag = previous_tag; }
+#else
+	public:
+		_FORCE_INLINE_ TagScope(Tag p_tag) {}
+#endif
+	};
+
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
+	static void *alloc_tagged(size_t p_bytes, Tag p_tag, bool p_pad_align = false);
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
 
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static const char *get_tag_name(Tag p_tag);
+	static uint64_t get_tag_usage(Tag p_tag);
+	static uint64_t get_tag_max_usage(Tag p_tag);
+	// Number of allocations made with the tag since startup, freed or not.
+	static uint64_t get_tag_alloc_count(Tag p_tag);
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
+};
+
+// DefaultAllocator attributing its allocations to a tag, whatever TagScope is active.
+template <Memory::Tag T>
+class TaggedAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_tagged(p_memory, T, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_memory) { return p_ptr ? Memory::realloc_static(p_ptr, p_memory, false) : alloc(p_memory); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
+void *operator new(size_t p_size, const Memory::TagScope &p_tag_scope); ///< operator new that attributes the allocation, and the ones made while constructing, to a tag
 
 void *operator new(size_t p_size, void *p_pointer, size_t check, const char *p_description); ///< operator new that takes a description and uses a pointer to the preallocated memory
 
@@ -76,6 +131,7 @@ void *operator new(size_t p_size, void *p_pointer, size_t check, const char *p_d
 // The purpose of the following definitions is to muffle these warnings, not to provide a usable implementation of placement delete.
 void operator delete(void *p_mem, const char *p_description);
 void operator delete(void *p_mem, void *(*p_allocfunc)(size_t p_size));
+void operator delete(void *p_mem, const Memory::TagScope &p_tag_scope);
 void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_description);
 #endif
 
@@ -93,6 +149,7 @@ _ALWAYS_INLINE_ T *_post_initialize(T *p_obj) {
 
 #define memnew(m_class) _post_initialize(new ("") m_class)
 
+#define memnew_tagged(m_class, m_tag) _post_initialize(new (Memory::TagScope(m_tag)) m_class)
 #define memnew_allocator(m_class, m_allocator) _post_initialize(new (m_allocator::alloc) m_class)
 #define memnew_placement(m_placement, m_class) _post_initialize(new (m_placement) m_class)
 
@@ -0,0 +1,365 @@
+/**************************************************************************/
+/*  small_allocator.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "small_allocator.h"
+
+#include "core/error/error_macros.h"
+#include "core/os/spin_lock.h"
+#include "core/string/print_string.h"
+#include "core/variant/variant.h"
+
+#include <stdlib.h>
+#include <atomic>
+
+namespace {
+
+struct SizeClassTables {
+	uint32_t block_size[SmallAllocator::SIZE_CLASS_COUNT] = {};
+	uint32_t batch_size[SmallAllocator::SIZE_CLASS_COUNT] = {};
+	uint8_t size_class[SmallAllocator::MAX_SIZE / SmallAllocator::GRANULARITY] = {};
+
+	constexpr SizeClassTables() {
+		// Multiples of the granularity up to 128 bytes, then four size classes per power of two,
+		// which keeps the internal fragmentation under 25%.
+		for (uint32_t i = 0; i < SmallAllocator::SIZE_CLASS_COUNT; i++) {
+			if (i < 8) {
+				block_size[i] = (i + 1) * SmallAllocator::GRANULARITY;
+			} else {
+				const uint32_t shift = 7 + (i - 8) / 4;
+				block_size[i] = (1u << shift) + ((i - 8) % 4 + 1) * (1u << (shift - 2));
+			}
+			// Blocks exchanged with the shared pool at once.
+			const uint32_t batch = SmallAllocator::SLAB_SIZE / block_size[i] / 4;
+			batch_size[i] = batch > 64 ? 64 : batch;
+		}
+
+		uint32_t c = 0;
+		for (uint32_t i = 0; i < SmallAllocator::MAX_SIZE / SmallAllocator::GRANULARITY; i++) {
+			if ((i + 1) * SmallAllocator::GRANULARITY > block_size[c]) {
+				c++;
+			}
+			size_class[i] = c;
+		}
+	}
+};
+
+constexpr SizeClassTables tables;
+static_assert(tables.block_size[SmallAllocator::SIZE_CLASS_COUNT - 1] == SmallAllocator::MAX_SIZE, "The last size class must match MAX_SIZE.");
+
+struct Block {
+	Block *next;
+};
+
+struct Pool {
+	SpinLock lock;
+	Block *free_list = nullptr;
+	uint64_t slab_count = 0;
+};
+
+Pool pools[SmallAllocator::SIZE_CLASS_COUNT];
+
+// Trivially constructible and destructible, so it's usable at any point of the thread lifetime.
+// Counters are only written by the owner thread, but read by others when gathering statistics.
+struct ThreadCache {
+	Block *free_list[SmallAllocator::SIZE_CLASS_COUNT];
+	uint32_t free_count[SmallAllocator::SIZE_CLASS_COUNT];
+	std::atomic<uint64_t> allocations[SmallAllocator::SIZE_CLASS_COUNT];
+	std::atomic<uint64_t> frees[SmallAllocator::SIZE_CLASS_COUNT];
+	ThreadCache *prev;
+	ThreadCache *next;
+	bool registered;
+	bool retired;
+};
+
+thread_local ThreadCache thread_cache;
+
+SpinLock registry_lock;
+ThreadCache *registry = nullptr;
+// Counters of threads which already exited, or of allocations made while exiting.
+std::atomic<uint64_t> retired_allocations[SmallAllocator::SIZE_CLASS_COUNT];
+std::atomic<uint64_t> retired_frees[SmallAllocator::SIZE_CLASS_COUNT];
+
+void _retire_thread_cache();
+
+// Returns the cached blocks to the shared pools when the thread exits.
+struct ThreadCacheGuard {
+	bool active = false;
+
+	~ThreadCacheGuard() {
+		if (active) {
+			_retire_thread_cache();
+		}
+	}
+};
+
+thread_local ThreadCacheGuard thread_cache_guard;
+
+_FORCE_INLINE_ void _count(std::atomic<uint64_t> &r_counter) {
+	r_counter.store(r_counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void _register_thread_cache(ThreadCache &r_cache) {
+	r_cache.registered = true;
+	thread_cache_guard.active = true;
+
+	registry_lock.lock();
+	r_cache.prev = nullptr;
+	r_cache.next = registry;
+	if (registry) {
+		registry->prev = &r_cache;
+	}
+	registry = &r_cache;
+	registry_lock.unlock();
+}
+
+void _push_to_pool(uint32_t p_size_class, Block *p_first, Block *p_last) {
+	Pool &pool = pools[p_size_class];
+	pool.lock.lock();
+	p_last->next = pool.free_list;
+	pool.free_list = p_first;
+	pool.lock.unlock();
+}
+
+void _retire_thread_cache() {
+	ThreadCache &cache = thread_cache;
+	cache.retired = true;
+
+	for (uint32_t i = 0; i < SmallAllocator::SIZE_CLASS_COUNT; i++) {
+		Block *first = cache.free_list[i];
+		if (!first) {
+			continue;
+		}
+		Block *last = first;
+		while (last->next) {
+			last = last->next;
+		}
+		_push_to_pool(i, first, last);
+		cache.free_list[i] = nullptr;
+		cache.free_count[i] = 0;
+	}
+
+	registry_lock.lock();
+	for (uint32_t i = 0; i < SmallAllocator::SIZE_CLASS_COUNT; i++) {
+		retired_allocations[i].fetch_add(cache.allocations[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		retired_frees[i].fetch_add(cache.frees[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	if (cache.prev) {
+		cache.prev->next = cache.next;
+	} else {
+		registry = cache.next;
+	}
+	if (cache.next) {
+		cache.next->prev = cache.prev;
+	}
+	registry_lock.unlock();
+}
+
+// Takes up to p_max blocks from the shared pool, carving a new slab if it's empty.
+Block *_take_from_pool(uint32_t p_size_class, uint32_t p_max, uint32_t &r_count) {
+	Pool &pool = pools[p_size_class];
+
+	pool.lock.lock();
+	Block *first = pool.free_list;
+	if (first) {
+		Block *last = first;
+		r_count = 1;
+		while (r_count < p_max && last->next) {
+			last = last->next;
+			r_count++;
+		}
+		pool.free_list = last->next;
+		last->next = nullptr;
+	}
+	pool.lock.unlock();
+
+	if (first) {
+		return first;
+	}
+
+	uint8_t *slab = (uint8_t *)::malloc(SmallAllocator::SLAB_SIZE);
+	ERR_FAIL_NULL_V(slab, nullptr);
+
+	const uint32_t size = tables.block_size[p_size_class];
+	const uint32_t count = SmallAllocator::SLAB_SIZE / size;
+	for (uint32_t i = 0; i < count - 1; i++) {
+		((Block *)(slab + i * size))->next = (Block *)(slab + (i + 1) * size);
+	}
+
+	// The first blocks are returned, the rest goes to the pool.
+	r_count = MIN(p_max, count);
+	Block *last = (Block *)(slab + (r_count - 1) * size);
+	Block *rest = r_count < count ? last->next : nullptr;
+	last->next = nullptr;
+
+	pool.lock.lock();
+	if (rest) {
+		((Block *)(slab + (count - 1) * size))->next = pool.free_list;
+		pool.free_list = rest;
+	}
+	pool.slab_count++;
+	pool.lock.unlock();
+
+	return (Block *)slab;
+}
+
+Block *_alloc_slow(ThreadCache &r_cache, uint32_t p_size_class) {
+	uint32_t count = 0;
+
+	if (unlikely(r_cache.retired)) {
+		// The thread is exiting, don't cache anything anymore.
+		Block *block = _take_from_pool(p_size_class, 1, count);
+		if (block) {
+			retired_allocations[p_size_class].fetch_add(1, std::memory_order_relaxed);
+		}
+		return block;
+	}
+
+	if (!r_cache.registered) {
+		_register_thread_cache(r_cache);
+	}
+
+	Block *block = _take_from_pool(p_size_class, tables.batch_size[p_size_class], count);
+	if (!block) {
+		return nullptr;
+	}
+
+	r_cache.free_list[p_size_class] = block->next;
+	r_cache.free_count[p_size_class] = count - 1;
+	_count(r_cache.allocations[p_size_class]);
+	return block;
+}
+
+void _return_batch(ThreadCache &r_cache, uint32_t p_size_class) {
+	const uint32_t batch = tables.batch_size[p_size_class];
+
+	Block *first = r_cache.free_list[p_size_class];
+	Block *last = first;
+	for (uint32_t i = 1; i < batch; i++) {
+		last = last->next;
+	}
+	r_cache.free_list[p_size_class] = last->next;
+	r_cache.free_count[p_size_class] -= batch;
+
+	_push_to_pool(p_size_class, first, last);
+}
+
+} // namespace
+
+uint32_t SmallAllocator::get_size_class(size_t p_bytes) {
+	DEV_ASSERT(is_small(p_bytes));
+	return tables.size_class[(p_bytes - 1) / GRANULARITY];
+}
+
+uint32_t SmallAllocator::get_size_class_block_size(uint32_t p_size_class) {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_size_class, SIZE_CLASS_COUNT, 0);
+	return tables.block_size[p_size_class];
+}
+
+void *SmallAllocator::alloc(size_t p_bytes) {
+	const uint32_t size_class = get_size_class(p_bytes);
+	ThreadCache &cache = thread_cache;
+
+	Block *block = cache.free_list[size_class];
+	if (unlikely(!block)) {
+		return _alloc_slow(cache, size_class);
+	}
+
+	cache.free_list[size_class] = block->next;
+	cache.free_count[size_class]--;
+	_count(cache.allocations[size_class]);
+	return block;
+}
+
+void SmallAllocator::free(void *p_ptr, size_t p_bytes) {
+	const uint32_t size_class = get_size_class(p_bytes);
+	ThreadCache &cache = thread_cache;
+	Block *block = (Block *)p_ptr;
+
+	if (unlikely(cache.retired)) {
+		block->next = nullptr;
+		_push_to_pool(size_class, block, block);
+		retired_frees[size_class].fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	if (unlikely(!cache.registered)) {
+		_register_thread_cache(cache);
+	}
+
+	block->next = cache.free_list[size_class];
+	cache.free_list[size_class] = block;
+	_count(cache.frees[size_class]);
+
+	if (unlikely(++cache.free_count[size_class] > 2 * tables.batch_size[size_class])) {
+		_return_batch(cache, size_class);
+	}
+}
+
+SmallAllocator::SizeClassStats SmallAllocator::get_size_class_stats(uint32_t p_size_class) {
+	SizeClassStats stats;
+	ERR_FAIL_UNSIGNED_INDEX_V(p_size_class, SIZE_CLASS_COUNT, stats);
+
+	stats.block_size = tables.block_size[p_size_class];
+
+	uint64_t frees = 0;
+	registry_lock.lock();
+	stats.allocations = retired_allocations[p_size_class].load(std::memory_order_relaxed);
+	frees = retired_frees[p_size_class].load(std::memory_order_relaxed);
+	for (ThreadCache *cache = registry; cache; cache = cache->next) {
+		stats.allocations += cache->allocations[p_size_class].load(std::memory_order_relaxed);
+		frees += cache->frees[p_size_class].load(std::memory_order_relaxed);
+	}
+	registry_lock.unlock();
+	// Blocks can be freed by a thread other than the one allocating them, only the sum is meaningful.
+	stats.in_use = stats.allocations > frees ? stats.allocations - frees : 0;
+
+	Pool &pool = pools[p_size_class];
+	pool.lock.lock();
+	stats.reserved = pool.slab_count * SLAB_SIZE;
+	pool.lock.unlock();
+
+	return stats;
+}
+
+void SmallAllocator::print_stats() {
+	print_line("Small allocator size classes:");
+	uint64_t total_in_use = 0;
+	uint64_t total_reserved = 0;
+	for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+		const SizeClassStats stats = get_size_class_stats(i);
+		if (stats.allocations == 0) {
+			continue;
+		}
+		print_line(vformat("%5d bytes: %d allocations, %d in use, %s reserved", stats.block_size, stats.allocations, stats.in_use, String::humanize_size(stats.reserved)));
+		total_in_use += stats.in_use * stats.block_size;
+		total_reserved += stats.reserved;
+	}
+	print_line(vformat("Total: %s in use, %s reserved", String::humanize_size(total_in_use), String::humanize_size(total_reserved)));
+}
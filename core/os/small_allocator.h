@@ -0,0 +1,74 @@
+/**************************************************************************/
+/*  small_allocator.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SMALL_ALLOCATOR_H
+#define SMALL_ALLOCATOR_H
+
+#include "core/typedefs.h"
+
+// Thread-caching allocator for small blocks, used by Memory when built with
+// `small_allocator=yes` (SMALL_ALLOCATOR_ENABLED).
+//
+// Requests are rounded up to one of a fixed set of size classes. Each thread
+// keeps a free list per size class and only takes the (per size class) lock
+// of the shared pool when exchanging a batch of blocks with it. Blocks are
+// carved from slabs which are kept for the lifetime of the process.
+//
+// The size of a block must be provided when freeing it, Memory keeps it in
+// the padding header of every allocation.
+
+class SmallAllocator {
+public:
+	static constexpr uint32_t GRANULARITY = 16;
+	static constexpr uint32_t MAX_SIZE = 2048;
+	static constexpr uint32_t SIZE_CLASS_COUNT = 24;
+	static constexpr uint32_t SLAB_SIZE = 64 * 1024;
+
+	struct SizeClassStats {
+		uint32_t block_size = 0;
+		uint64_t allocations = 0; // Total, since startup.
+		uint64_t in_use = 0;
+		uint64_t reserved = 0; // Bytes taken from the system for this size class.
+	};
+
+	_FORCE_INLINE_ static bool is_small(size_t p_bytes) { return p_bytes > 0 && p_bytes <= MAX_SIZE; }
+	static uint32_t get_size_class(size_t p_bytes);
+	static uint32_t get_size_class_block_size(uint32_t p_size_class);
+
+	// p_bytes must satisfy is_small().
+	static void *alloc(size_t p_bytes);
+	static void free(void *p_ptr, size_t p_bytes);
+
+	// Counters of other threads are read without synchronizing with them, so they may lag slightly behind.
+	static SizeClassStats get_size_class_stats(uint32_t p_size_class);
+	static void print_stats();
+};
+
+#endif // SMALL_ALLOCATOR_H
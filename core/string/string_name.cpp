@@ -32,6 +32,8 @@
 
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/local_vector.h"
 
 StaticCString StaticCString::create(const char *p_ptr) {
 	StaticCString scs;
@@ -39,7 +41,121 @@ StaticCString StaticCString::create(const char *p_ptr) {
 	return scs;
 }
 
-StringName::_Data *StringName::_table[STRING_TABLE_LEN];
+// Names are looked up without locking, only adding and removing them takes the mutex.
+//
+// A thread looking up a name announces the epoch it started reading at. Names and
+// tables removed by other threads in the meantime are retired instead of deleted, and
+// only reclaimed once all the threads reading have announced a later epoch, so a thread
+// reading never accesses freed memory. A name found while its last reference is being
+// released can't be referenced anymore, so it's treated as missing.
+
+struct StringName::_Table {
+	uint32_t capacity = 0; // Power of two.
+	uint32_t count = 0; // Names.
+	uint32_t used = 0; // Names and tombstones.
+	std::atomic<_Data *> *entries = nullptr;
+};
+
+namespace {
+
+enum {
+	INITIAL_TABLE_CAPACITY = 1 << 14,
+	MAX_READERS = 256,
+	RECLAIM_THRESHOLD = 64,
+};
+
+// Marks a removed entry, so probing goes on past it.
+void *const TOMBSTONE = (void *)uintptr_t(1);
+
+// String hashes of similar names are close to each other, which would make long runs of linear probing.
+_FORCE_INLINE_ uint32_t _get_first_slot(uint32_t p_hash, uint32_t p_mask) {
+	return hash_fmix32(p_hash) & p_mask;
+}
+
+struct alignas(64) ReaderSlot {
+	std::atomic<uint64_t> epoch = { 0 }; // Zero when not reading.
+	std::atomic<bool> used = { false };
+};
+
+ReaderSlot reader_slots[MAX_READERS];
+std::atomic<uint32_t> reader_slot_count = { 0 }; // High water mark.
+std::atomic<uint64_t> epoch = { 1 };
+
+struct ThreadReader {
+	ReaderSlot *slot = nullptr;
+	bool unavailable = false;
+
+	~ThreadReader() {
+		// Let other threads use the slot.
+		if (slot) {
+			slot->used.store(false, std::memory_order_release);
+		}
+	}
+};
+
+thread_local ThreadReader thread_reader;
+
+ReaderSlot *_get_reader_slot() {
+	ThreadReader &reader = thread_reader;
+	if (likely(reader.slot || reader.unavailable)) {
+		return reader.slot;
+	}
+
+	for (uint32_t i = 0; i < MAX_READERS; i++) {
+		bool expected = false;
+		if (!reader_slots[i].used.load(std::memory_order_relaxed) && reader_slots[i].used.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+			uint32_t count = reader_slot_count.load(std::memory_order_relaxed);
+			while (count <= i && !reader_slot_count.compare_exchange_weak(count, i + 1, std::memory_order_acq_rel)) {
+			}
+			reader.slot = &reader_slots[i];
+			return reader.slot;
+		}
+	}
+
+	// Too many threads, this one will lock instead.
+	reader.unavailable = true;
+	return nullptr;
+}
+
+// Announces the thread is reading the table while in scope.
+struct ReadGuard {
+	ReaderSlot *slot = nullptr;
+
+	ReadGuard() {
+		slot = _get_reader_slot();
+		if (slot) {
+			// Sequentially consistent, so the table isn't read before this is visible to other threads.
+			slot->epoch.store(epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+		}
+	}
+
+	~ReadGuard() {
+		if (slot) {
+			slot->epoch.store(0, std::memory_order_release);
+		}
+	}
+};
+
+struct Retired {
+	void *ptr = nullptr;
+	bool table = false;
+	uint64_t epoch = 0;
+};
+
+LocalVector<Retired> retired; // Protected by the mutex.
+
+void _retire(void *p_ptr, bool p_table) {
+	Retired r;
+	r.ptr = p_ptr;
+	r.table = p_table;
+	// Threads which start reading after this can't find the pointer anymore.
+	r.epoch = epoch.fetch_add(1, std::memory_order_seq_cst);
+	retired.push_back(r);
+}
+
+} //namespace
+
+std::atomic<StringName::_Table *> StringName::table = { nullptr };
 
 StringName _scs_create(const char *p_chr, bool p_static) {
 	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
@@ -52,25 +168,167 @@ Mutex StringName::mutex;
 bool StringName::debug_stringname = false;
 #endif
 
+StringName::_Table *StringName::_create_table(uint32_t p_capacity) {
+	_Table *t = memnew(_Table);
+	t->capacity = p_capacity;
+	t->entries = memnew_arr(std::atomic<_Data *>, p_capacity);
+	for (uint32_t i = 0; i < p_capacity; i++) {
+		t->entries[i].store(nullptr, std::memory_order_relaxed);
+	}
+	return t;
+}
+
+void StringName::_delete_table(_Table *p_table) {
+	memdelete_arr(p_table->entries);
+	memdelete(p_table);
+}
+
+template <class T>
+StringName::_Data *StringName::_lookup(uint32_t p_hash, const T &p_name) {
+	ReadGuard guard;
+	if (unlikely(!guard.slot)) {
+		mutex.lock();
+	}
+
+	_Data *found = nullptr;
+	const _Table *t = table.load(std::memory_order_acquire);
+	const uint32_t mask = t->capacity - 1;
+	for (uint32_t i = _get_first_slot(p_hash, mask);; i = (i + 1) & mask) {
+		_Data *d = t->entries[i].load(std::memory_order_acquire);
+		if (!d) {
+			break;
+		}
+		// compare hash first
+		// Referencing fails if its last reference is being released, a new entry may follow then.
+		if (d != TOMBSTONE && d->hash == p_hash && d->get_name() == p_name && d->refcount.ref()) {
+			found = d;
+			break;
+		}
+	}
+
+	if (unlikely(!guard.slot)) {
+		mutex.unlock();
+	}
+	return found;
+}
+
+void StringName::_insert(_Data *p_data) {
+	_Table *t = table.load(std::memory_order_relaxed);
+
+	// Keep the table at most 3/4 used, so probing is short and always ends.
+	if ((t->used + 1) * 4 > t->capacity * 3) {
+		// Tombstones are dropped, so it may not need to grow.
+		uint32_t capacity = t->capacity;
+		while ((t->count + 1) * 2 > capacity) {
+			capacity <<= 1;
+		}
+
+		_Table *new_table = _create_table(capacity);
+		const uint32_t mask = capacity - 1;
+		for (uint32_t i = 0; i < t->capacity; i++) {
+			_Data *d = t->entries[i].load(std::memory_order_relaxed);
+			if (!d || d == TOMBSTONE) {
+				continue;
+			}
+			uint32_t j = _get_first_slot(d->hash, mask);
+			while (new_table->entries[j].load(std::memory_order_relaxed)) {
+				j = (j + 1) & mask;
+			}
+			new_table->entries[j].store(d, std::memory_order_relaxed);
+		}
+		new_table->count = t->count;
+		new_table->used = t->count;
+
+		table.store(new_table, std::memory_order_release);
+		_retire(t, true);
+		t = new_table;
+	}
+
+	const uint32_t mask = t->capacity - 1;
+	uint32_t i = _get_first_slot(p_data->hash, mask);
+	while (true) {
+		_Data *d = t->entries[i].load(std::memory_order_relaxed);
+		if (!d || d == TOMBSTONE) {
+			if (!d) {
+				t->used++;
+			}
+			break;
+		}
+		i = (i + 1) & mask;
+	}
+	t->count++;
+	t->entries[i].store(p_data, std::memory_order_release);
+}
+
+void StringName::_remove(_Data *p_data) {
+	_Table *t = table.load(std::memory_order_relaxed);
+	const uint32_t mask = t->capacity - 1;
+	for (uint32_t i = _get_first_slot(p_data->hash, mask);; i = (i + 1) & mask) {
+		_Data *d = t->entries[i].load(std::memory_order_relaxed);
+		if (d == p_data) {
+			t->entries[i].store((_Data *)TOMBSTONE, std::memory_order_release);
+			t->count--;
+			break;
+		}
+		if (!d) {
+			ERR_PRINT("BUG!");
+			return;
+		}
+	}
+
+	_retire(p_data, false);
+	if (retired.size() >= RECLAIM_THRESHOLD) {
+		_reclaim(false);
+	}
+}
+
+void StringName::_reclaim(bool p_all) {
+	uint64_t oldest = UINT64_MAX;
+	if (!p_all) {
+		const uint32_t count = reader_slot_count.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++) {
+			uint64_t e = reader_slots[i].epoch.load(std::memory_order_seq_cst);
+			if (e != 0 && e < oldest) {
+				oldest = e;
+			}
+		}
+	}
+
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < retired.size(); i++) {
+		const Retired &r = retired[i];
+		// Threads which started reading at the retire epoch or earlier may still see it.
+		if (r.epoch >= oldest) {
+			retired[kept++] = r;
+			continue;
+		}
+		if (r.table) {
+			_delete_table((_Table *)r.ptr);
+		} else {
+			memdelete((_Data *)r.ptr);
+		}
+	}
+	retired.resize(kept);
+}
+
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		_table[i] = nullptr;
-	}
+	table.store(_create_table(INITIAL_TABLE_CAPACITY), std::memory_order_release);
 	configured = true;
 }
 
 void StringName::cleanup() {
 	MutexLock lock(mutex);
 
+	_Table *t = table.load(std::memory_order_relaxed);
+
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
-		for (int i = 0; i < STRING_TABLE_LEN; i++) {
-			_Data *d = _table[i];
-			while (d) {
+		for (uint32_t i = 0; i < t->capacity; i++) {
+			_Data *d = t->entries[i].load(std::memory_order_relaxed);
+			if (d && d != TOMBSTONE) {
 				data.push_back(d);
-				d = d->next;
 			}
 		}
 
@@ -80,10 +338,10 @@ void StringName::cleanup() {
 		int unreferenced_stringnames = 0;
 		int rarely_referenced_stringnames = 0;
 		for (int i = 0; i < data.size(); i++) {
-			print_line(itos(i + 1) + ": " + data[i]->get_name() + " - " + itos(data[i]->debug_references));
-			if (data[i]->debug_references == 0) {
+			print_line(itos(i + 1) + ": " + data[i]->get_name() + " - " + itos(data[i]->debug_references.get()));
+			if (data[i]->debug_references.get() == 0) {
 				unreferenced_stringnames += 1;
-			} else if (data[i]->debug_references < 5) {
+			} else if (data[i]->debug_references.get() < 5) {
 				rarely_referenced_stringnames += 1;
 			}
 		}
@@ -93,28 +351,33 @@ void StringName::cleanup() {
 	}
 #endif
 	int lost_strings = 0;
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
-		while (_table[i]) {
-			_Data *d = _table[i];
-			if (d->static_count.get() != d->refcount.get()) {
-				lost_strings++;
-
-				if (OS::get_singleton()->is_stdout_verbose()) {
-					if (d->cname) {
-						print_line("Orphan StringName: " + String(d->cname));
-					} else {
-						print_line("Orphan StringName: " + String(d->name));
-					}
+	for (uint32_t i = 0; i < t->capacity; i++) {
+		_Data *d = t->entries[i].load(std::memory_order_relaxed);
+		if (!d || d == TOMBSTONE) {
+			continue;
+		}
+		if (d->static_count.get() != d->refcount.get()) {
+			lost_strings++;
+
+			if (OS::get_singleton()->is_stdout_verbose()) {
+				if (d->cname) {
+					print_line("Orphan StringName: " + String(d->cname));
+				} else {
+					print_line("Orphan StringName: " + String(d->name));
 				}
 			}
-
-			_table[i] = _table[i]->next;
-			memdelete(d);
 		}
+
+		memdelete(d);
 	}
 	if (lost_strings) {
 		print_verbose("StringName: " + itos(lost_strings) + " unclaimed string names at exit.");
 	}
+
+	_reclaim(true);
+	retired.reset();
+	table.store(nullptr, std::memory_order_relaxed);
+	_delete_table(t);
 	configured = false;
 }
 
@@ -131,19 +394,7 @@ void StringName::unref() {
 				ERR_PRINT("BUG: Unreferenced static string to 0: " + String(_data->name));
 			}
 		}
-		if (_data->prev) {
-			_data->prev->next = _data->next;
-		} else {
-			if (_table[_data->idx] != _data) {
-				ERR_PRINT("BUG!");
-			}
-			_table[_data->idx] = _data->next;
-		}
-
-		if (_data->next) {
-			_data->next->prev = _data->prev;
-		}
-		memdelete(_data);
+		_remove(_data);
 	}
 
 	_data = nullptr;
@@ -154,7 +405,11 @@ bool StringName::operator==(const String &p_name) const {
 		return (p_name.length() == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	// Compare against the static name directly instead of making a String out of it.
+	if (_data->cname) {
+		return p_name == _data->cname;
+	}
+	return (_data->name == p_name);
 }
 
 bool StringName::operator==(const char *p_name) const {
@@ -162,7 +417,10 @@ bool StringName::operator==(const char *p_name) const {
 		return (p_name[0] == 0);
 	}
 
-	return (_data->get_name() == p_name);
+	if (_data->cname) {
+		return strcmp(_data->cname, p_name) == 0;
+	}
+	return (_data->name == p_name);
 }
 
 bool StringName::operator!=(const String &p_name) const {
@@ -218,56 +476,43 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_data = _lookup(hash, p_name);
 
-	_data = _table[idx];
+	if (!_data) {
+		MutexLock lock(mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+		// Look again, it may have been added in the meantime.
+		_data = _lookup(hash, p_name);
 
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
+		if (!_data) {
+			_data = memnew(_Data);
+			_data->name = p_name;
+			_data->refcount.init();
+			_data->static_count.set(p_static ? 1 : 0);
+			_data->hash = hash;
 #ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				_data->refcount.ref();
+				_data->static_count.increment();
+			}
 #endif
-		return;
+			_insert(_data);
+			return;
+		}
 	}
 
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
-
+	// exists
+	if (p_static) {
+		_data->static_count.increment();
+	}
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
+		_data->debug_references.increment();
 	}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
 }
 
 StringName::StringName(const StaticCString &p_static_string, bool p_static) {
@@ -277,55 +522,43 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	_data = _lookup(hash, p_static_string.ptr);
 
-	_data = _table[idx];
+	if (!_data) {
+		MutexLock lock(mutex);
 
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_static_string.ptr) {
-			break;
-		}
-		_data = _data->next;
-	}
+		// Look again, it may have been added in the meantime.
+		_data = _lookup(hash, p_static_string.ptr);
 
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
+		if (!_data) {
+			_data = memnew(_Data);
+			_data->cname = p_static_string.ptr;
+			_data->refcount.init();
+			_data->static_count.set(p_static ? 1 : 0);
+			_data->hash = hash;
 #ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				_data->refcount.ref();
+				_data->static_count.increment();
+			}
 #endif
-		return;
+			_insert(_data);
+			return;
+		}
 	}
 
-	_data = memnew(_Data);
-
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
+	// exists
+	if (p_static) {
+		_data->static_count.increment();
+	}
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
+		_data->debug_references.increment();
 	}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -337,54 +570,43 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
 
-	_data = _table[idx];
+	_data = _lookup(hash, p_name);
 
-	while (_data) {
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	if (!_data) {
+		MutexLock lock(mutex);
 
-	if (_data && _data->refcount.ref()) {
-		// exists
-		if (p_static) {
-			_data->static_count.increment();
-		}
+		// Look again, it may have been added in the meantime.
+		_data = _lookup(hash, p_name);
+
+		if (!_data) {
+			_data = memnew(_Data);
+			_data->name = p_name;
+			_data->refcount.init();
+			_data->static_count.set(p_static ? 1 : 0);
+			_data->hash = hash;
 #ifdef DEBUG_ENABLED
-		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
-		}
+			if (unlikely(debug_stringname)) {
+				// Keep in memory, force static.
+				_data->refcount.ref();
+				_data->static_count.increment();
+			}
 #endif
-		return;
+			_insert(_data);
+			return;
+		}
 	}
 
-	_data = memnew(_Data);
-	_data->name = p_name;
-	_data->refcount.init();
-	_data->static_count.set(p_static ? 1 : 0);
-	_data->hash = hash;
-	_data->idx = idx;
-	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
+	// exists
+	if (p_static) {
+		_data->static_count.increment();
+	}
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
-		// Keep in memory, force static.
-		_data->refcount.ref();
-		_data->static_count.increment();
+		_data->debug_references.increment();
 	}
 #endif
-
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
 }
 
 StringName StringName::search(const char *p_name) {
@@ -395,25 +617,12 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_name);
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _lookup(String::hash(p_name), p_name);
 
-	if (_data && _data->refcount.ref()) {
+	if (_data) {
 #ifdef DEBUG_ENABLED
 		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
+			_data->debug_references.increment();
 		}
 #endif
 
@@ -431,23 +640,9 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = String::hash(p_name);
-
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && _data->get_name() == p_name) {
-			break;
-		}
-		_data = _data->next;
-	}
+	_Data *_data = _lookup(String::hash(p_name), p_name);
 
-	if (_data && _data->refcount.ref()) {
+	if (_data) {
 		return StringName(_data);
 	}
 
@@ -457,28 +652,15 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
-	uint32_t hash = p_name.hash();
+	_Data *_data = _lookup(p_name.hash(), p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
-
-	_Data *_data = _table[idx];
-
-	while (_data) {
-		// compare hash first
-		if (_data->hash == hash && p_name == _data->get_name()) {
-			break;
-		}
-		_data = _data->next;
-	}
-
-	if (_data && _data->refcount.ref()) {
+	if (_data) {
 #ifdef DEBUG_ENABLED
 		if (unlikely(debug_stringname)) {
-			_data->debug_references++;
+			_data->debug_references.increment();
 		}
 #endif
+
 		return StringName(_data);
 	}
 
@@ -486,15 +668,15 @@ StringName StringName::search(const String &p_name) {
 }
 
 bool operator==(const String &p_name, const StringName &p_string_name) {
-	return p_name == p_string_name.operator String();
+	return p_string_name == p_name;
 }
 bool operator!=(const String &p_name, const StringName &p_string_name) {
-	return p_name != p_string_name.operator String();
+	return p_string_name != p_name;
 }
 
 bool operator==(const char *p_name, const StringName &p_string_name) {
-	return p_name == p_string_name.operator String();
+	return p_string_name == p_name;
 }
 bool operator!=(const char *p_name, const StringName &p_string_name) {
-	return p_name != p_string_name.operator String();
+	return p_string_name != p_name;
 }
@@ -45,29 +45,32 @@ struct StaticCString {
 };
 
 class StringName {
-	enum {
-		STRING_TABLE_BITS = 16,
-		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
-	};
-
 	struct _Data {
 		SafeRefCount refcount;
 		SafeNumeric<uint32_t> static_count;
 		const char *cname = nullptr;
 		String name;
 #ifdef DEBUG_ENABLED
-		uint32_t debug_references = 0;
+		SafeNumeric<uint32_t> debug_references;
 #endif
 		String get_name() const { return cname ? String(cname) : name; }
-		int idx = 0;
 		uint32_t hash = 0;
-		_Data *prev = nullptr;
-		_Data *next = nullptr;
 		_Data() {}
 	};
 
-	static _Data *_table[STRING_TABLE_LEN];
+	// Open addressing table of all the names. It's only modified with the mutex held,
+	// but looking up existing names doesn't lock, see string_name.cpp.
+	struct _Table;
+	static std::atomic<_Table *> table;
+
+	static _Table *_create_table(uint32_t p_capacity);
+	static void _delete_table(_Table *p_table);
+
+	template <class T>
+	static _Data *_lookup(uint32_t p_hash, const T &p_name);
+	static void _insert(_Data *p_data);
+	static void _remove(_Data *p_data);
+	static void _reclaim(bool p_all);
 
 	_Data *_data = nullptr;
 
@@ -87,7 +90,7 @@ class StringName {
 #ifdef DEBUG_ENABLED
 	struct DebugSortReferences {
 		bool operator()(const _Data *p_left, const _Data *p_right) const {
-			return p_left->debug_references > p_right->debug_references;
+			return p_left->debug_references.get() > p_right->debug_references.get();
 		}
 	};
 
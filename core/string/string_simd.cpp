@@ -0,0 +1,369 @@
+/**************************************************************************/
+/*  string_simd.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "string_simd.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STRING_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define STRING_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// The vector loops only skip over blocks that need no special handling and
+// stop at the first block that does. The scalar loop that follows each of
+// them finishes the job, so it also handles the tail and the targets without
+// SIMD.
+
+#ifdef STRING_SIMD_SSE2
+// Lanes holding characters above 0x7f.
+static _FORCE_INLINE_ __m128i _non_ascii_epi32(__m128i p_chars) {
+	const __m128i zero = _mm_setzero_si128();
+	return _mm_xor_si128(_mm_cmpeq_epi32(_mm_and_si128(p_chars, _mm_set1_epi32(~0x7f)), zero), _mm_cmpeq_epi32(zero, zero));
+}
+#endif
+
+int StringSIMD::find_char(const char32_t *p_str, int p_len, char32_t p_char) {
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	const __m128i needle = _mm_set1_epi32((int)p_char);
+	for (; i + 8 <= p_len; i += 8) {
+		const __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(p_str + i)), needle);
+		const __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(p_str + i + 4)), needle);
+		if (_mm_movemask_epi8(_mm_or_si128(a, b))) {
+			break;
+		}
+	}
+#elif defined(STRING_SIMD_NEON)
+	const uint32x4_t needle = vdupq_n_u32(p_char);
+	for (; i + 8 <= p_len; i += 8) {
+		const uint32x4_t a = vceqq_u32(vld1q_u32((const uint32_t *)(p_str + i)), needle);
+		const uint32x4_t b = vceqq_u32(vld1q_u32((const uint32_t *)(p_str + i + 4)), needle);
+		if (vmaxvq_u32(vorrq_u32(a, b))) {
+			break;
+		}
+	}
+#endif
+	for (; i < p_len; i++) {
+		if (p_str[i] == p_char) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static _FORCE_INLINE_ bool _is_plain_ascii(uint8_t p_char) {
+	return p_char != 0 && p_char < 0x80 && p_char != '\r';
+}
+
+#if defined(STRING_SIMD_SSE2)
+static _FORCE_INLINE_ bool _is_plain_ascii_16(__m128i p_bytes) {
+	const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(p_bytes, _mm_setzero_si128()), _mm_cmpeq_epi8(p_bytes, _mm_set1_epi8('\r')));
+	// The sign bit of each byte is set for bytes above 0x7f.
+	return (_mm_movemask_epi8(p_bytes) | _mm_movemask_epi8(special)) == 0;
+}
+#elif defined(STRING_SIMD_NEON)
+static _FORCE_INLINE_ bool _is_plain_ascii_16(uint8x16_t p_bytes) {
+	const uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(p_bytes, vdupq_n_u8(0)), vceqq_u8(p_bytes, vdupq_n_u8('\r'))), vcgeq_u8(p_bytes, vdupq_n_u8(0x80)));
+	return vmaxvq_u8(special) == 0;
+}
+#endif
+
+int StringSIMD::ascii_length(const char *p_str, int p_len) {
+	const uint8_t *str = (const uint8_t *)p_str;
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	for (; i + 16 <= p_len; i += 16) {
+		if (!_is_plain_ascii_16(_mm_loadu_si128((const __m128i *)(str + i)))) {
+			break;
+		}
+	}
+#elif defined(STRING_SIMD_NEON)
+	for (; i + 16 <= p_len; i += 16) {
+		if (!_is_plain_ascii_16(vld1q_u8(str + i))) {
+			break;
+		}
+	}
+#endif
+	while (i < p_len && _is_plain_ascii(str[i])) {
+		i++;
+	}
+	return i;
+}
+
+int StringSIMD::ascii_length(const char32_t *p_str, int p_len) {
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	for (; i + 8 <= p_len; i += 8) {
+		const __m128i a = _mm_loadu_si128((const __m128i *)(p_str + i));
+		const __m128i b = _mm_loadu_si128((const __m128i *)(p_str + i + 4));
+		if (_mm_movemask_epi8(_non_ascii_epi32(_mm_or_si128(a, b)))) {
+			break;
+		}
+	}
+#elif defined(STRING_SIMD_NEON)
+	const uint32x4_t non_ascii = vdupq_n_u32(~0x7fu);
+	for (; i + 8 <= p_len; i += 8) {
+		const uint32x4_t a = vld1q_u32((const uint32_t *)(p_str + i));
+		const uint32x4_t b = vld1q_u32((const uint32_t *)(p_str + i + 4));
+		if (vmaxvq_u32(vtstq_u32(vorrq_u32(a, b), non_ascii))) {
+			break;
+		}
+	}
+#endif
+	while (i < p_len && p_str[i] <= 0x7f) {
+		i++;
+	}
+	return i;
+}
+
+int StringSIMD::widen_ascii(const char *p_src, char32_t *r_dst, int p_len) {
+	const uint8_t *src = (const uint8_t *)p_src;
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= p_len; i += 16) {
+		const __m128i bytes = _mm_loadu_si128((const __m128i *)(src + i));
+		if (!_is_plain_ascii_16(bytes)) {
+			break;
+		}
+		const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+		const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+		_mm_storeu_si128((__m128i *)(r_dst + i), _mm_unpacklo_epi16(lo, zero));
+		_mm_storeu_si128((__m128i *)(r_dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+		_mm_storeu_si128((__m128i *)(r_dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+		_mm_storeu_si128((__m128i *)(r_dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+	}
+#elif defined(STRING_SIMD_NEON)
+	for (; i + 16 <= p_len; i += 16) {
+		const uint8x16_t bytes = vld1q_u8(src + i);
+		if (!_is_plain_ascii_16(bytes)) {
+			break;
+		}
+		const uint16x8_t lo = vmovl_u8(vget_low_u8(bytes));
+		const uint16x8_t hi = vmovl_u8(vget_high_u8(bytes));
+		vst1q_u32((uint32_t *)(r_dst + i), vmovl_u16(vget_low_u16(lo)));
+		vst1q_u32((uint32_t *)(r_dst + i + 4), vmovl_u16(vget_high_u16(lo)));
+		vst1q_u32((uint32_t *)(r_dst + i + 8), vmovl_u16(vget_low_u16(hi)));
+		vst1q_u32((uint32_t *)(r_dst + i + 12), vmovl_u16(vget_high_u16(hi)));
+	}
+#endif
+	for (; i < p_len && _is_plain_ascii(src[i]); i++) {
+		r_dst[i] = src[i];
+	}
+	return i;
+}
+
+int StringSIMD::narrow_ascii(const char32_t *p_src, char *r_dst, int p_len) {
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	for (; i + 16 <= p_len; i += 16) {
+		const __m128i a = _mm_loadu_si128((const __m128i *)(p_src + i));
+		const __m128i b = _mm_loadu_si128((const __m128i *)(p_src + i + 4));
+		const __m128i c = _mm_loadu_si128((const __m128i *)(p_src + i + 8));
+		const __m128i d = _mm_loadu_si128((const __m128i *)(p_src + i + 12));
+		if (_mm_movemask_epi8(_non_ascii_epi32(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))))) {
+			break;
+		}
+		// All values fit in 7 bits, so the saturating packs are plain truncations.
+		_mm_storeu_si128((__m128i *)(r_dst + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+	}
+#elif defined(STRING_SIMD_NEON)
+	const uint32x4_t non_ascii = vdupq_n_u32(~0x7fu);
+	for (; i + 16 <= p_len; i += 16) {
+		const uint32x4_t a = vld1q_u32((const uint32_t *)(p_src + i));
+		const uint32x4_t b = vld1q_u32((const uint32_t *)(p_src + i + 4));
+		const uint32x4_t c = vld1q_u32((const uint32_t *)(p_src + i + 8));
+		const uint32x4_t d = vld1q_u32((const uint32_t *)(p_src + i + 12));
+		if (vmaxvq_u32(vtstq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d)), non_ascii))) {
+			break;
+		}
+		const uint16x8_t lo = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+		const uint16x8_t hi = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+		vst1q_u8((uint8_t *)(r_dst + i), vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+	}
+#endif
+	for (; i < p_len && p_src[i] <= 0x7f; i++) {
+		r_dst[i] = (char)p_src[i];
+	}
+	return i;
+}
+
+int StringSIMD::find_ascii_range(const char32_t *p_str, int p_len, char32_t p_first, char32_t p_last) {
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	const __m128i first = _mm_set1_epi32((int)p_first - 1);
+	const __m128i last = _mm_set1_epi32((int)p_last + 1);
+	for (; i + 4 <= p_len; i += 4) {
+		const __m128i chars = _mm_loadu_si128((const __m128i *)(p_str + i));
+		// Characters above 0x7f may compare as negative, but they are caught by the ASCII check anyway.
+		const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi32(chars, first), _mm_cmplt_epi32(chars, last));
+		if (_mm_movemask_epi8(_mm_or_si128(in_range, _non_ascii_epi32(chars)))) {
+			break;
+		}
+	}
+#elif defined(STRING_SIMD_NEON)
+	const uint32x4_t first = vdupq_n_u32(p_first);
+	const uint32x4_t last = vdupq_n_u32(p_last);
+	const uint32x4_t ascii_max = vdupq_n_u32(0x7f);
+	for (; i + 4 <= p_len; i += 4) {
+		const uint32x4_t chars = vld1q_u32((const uint32_t *)(p_str + i));
+		const uint32x4_t in_range = vandq_u32(vcgeq_u32(chars, first), vcleq_u32(chars, last));
+		if (vmaxvq_u32(vorrq_u32(in_range, vcgtq_u32(chars, ascii_max)))) {
+			break;
+		}
+	}
+#endif
+	for (; i < p_len; i++) {
+		if (p_str[i] > 0x7f || (p_str[i] >= p_first && p_str[i] <= p_last)) {
+			break;
+		}
+	}
+	return i;
+}
+
+// Adds p_offset to the characters in [p_first, p_last] of the leading ASCII run.
+static _FORCE_INLINE_ int _ascii_shift_range(const char32_t *p_src, char32_t *r_dst, int p_len, char32_t p_first, char32_t p_last, int p_offset) {
+	int i = 0;
+#if defined(STRING_SIMD_SSE2)
+	const __m128i first = _mm_set1_epi32((int)p_first - 1);
+	const __m128i last = _mm_set1_epi32((int)p_last + 1);
+	const __m128i offset = _mm_set1_epi32(p_offset);
+	for (; i + 4 <= p_len; i += 4) {
+		const __m128i chars = _mm_loadu_si128((const __m128i *)(p_src + i));
+		if (_mm_movemask_epi8(_non_ascii_epi32(chars))) {
+			break;
+		}
+		const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi32(chars, first), _mm_cmplt_epi32(chars, last));
+		_mm_storeu_si128((__m128i *)(r_dst + i), _mm_add_epi32(chars, _mm_and_si128(in_range, offset)));
+	}
+#elif defined(STRING_SIMD_NEON)
+	const uint32x4_t first = vdupq_n_u32(p_first);
+	const uint32x4_t last = vdupq_n_u32(p_last);
+	const uint32x4_t offset = vdupq_n_u32((uint32_t)p_offset);
+	const uint32x4_t ascii_max = vdupq_n_u32(0x7f);
+	for (; i + 4 <= p_len; i += 4) {
+		const uint32x4_t chars = vld1q_u32((const uint32_t *)(p_src + i));
+		if (vmaxvq_u32(vcgtq_u32(chars, ascii_max))) {
+			break;
+		}
+		const uint32x4_t in_range = vandq_u32(vcgeq_u32(chars, first), vcleq_u32(chars, last));
+		vst1q_u32((uint32_t *)(r_dst + i), vaddq_u32(chars, vandq_u32(in_range, offset)));
+	}
+#endif
+	for (; i < p_len && p_src[i] <= 0x7f; i++) {
+		const char32_t c = p_src[i];
+		r_dst[i] = (c >= p_first && c <= p_last) ? char32_t(c + p_offset) : c;
+	}
+	return i;
+}
+
+int StringSIMD::ascii_to_lower(const char32_t *p_src, char32_t *r_dst, int p_len) {
+	return _ascii_shift_range(p_src, r_dst, p_len, 'A', 'Z', 'a' - 'A');
+}
+
+int StringSIMD::ascii_to_upper(const char32_t *p_src, char32_t *r_dst, int p_len) {
+	return _ascii_shift_range(p_src, r_dst, p_len, 'a', 'z', 'A' - 'a');
+}
+
+static constexpr uint32_t _pow33(int p_exp) {
+	uint32_t result = 1;
+	for (int i = 0; i < p_exp; i++) {
+		result *= 33;
+	}
+	return result;
+}
+
+uint32_t StringSIMD::hash(const char32_t *p_str, int p_len, uint32_t p_hash) {
+	int i = 0;
+#if defined(STRING_SIMD_SSE2) || defined(STRING_SIMD_NEON)
+	// djb2 unrolled over blocks of 16 characters: after n blocks, lane k holds the
+	// sum of every character at position k of a block, times 33 to the power of
+	// 16 for each block that followed it. Weighting lane k by 33^(15 - k) then
+	// gives the sequential result. The initial hash is the "character" before
+	// the first block, so it starts in the last lane.
+	if (p_len >= 32) {
+		uint32_t lanes[16];
+#if defined(STRING_SIMD_SSE2)
+		// Only the low 32 bits of each accumulator matter, and _mm_mul_epu32 only
+		// reads those, so keep one character per 64-bit lane: even positions in
+		// the low lanes of "even", odd positions in the shifted down "odd".
+		const __m128i mul = _mm_set1_epi32((int)_pow33(16));
+		__m128i even[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+		__m128i odd[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_set_epi32(0, (int)p_hash, 0, 0) };
+		for (; i + 16 <= p_len; i += 16) {
+			for (int q = 0; q < 4; q++) {
+				const __m128i chars = _mm_loadu_si128((const __m128i *)(p_str + i + q * 4));
+				even[q] = _mm_add_epi32(_mm_mul_epu32(even[q], mul), chars);
+				odd[q] = _mm_add_epi32(_mm_mul_epu32(odd[q], mul), _mm_srli_epi64(chars, 32));
+			}
+		}
+		for (int q = 0; q < 4; q++) {
+			uint32_t values[8];
+			_mm_storeu_si128((__m128i *)values, even[q]);
+			_mm_storeu_si128((__m128i *)(values + 4), odd[q]);
+			lanes[q * 4 + 0] = values[0];
+			lanes[q * 4 + 1] = values[4];
+			lanes[q * 4 + 2] = values[2];
+			lanes[q * 4 + 3] = values[6];
+		}
+#else
+		const uint32x4_t mul = vdupq_n_u32(_pow33(16));
+		uint32x4_t acc0 = vdupq_n_u32(0);
+		uint32x4_t acc1 = vdupq_n_u32(0);
+		uint32x4_t acc2 = vdupq_n_u32(0);
+		uint32x4_t acc3 = vsetq_lane_u32(p_hash, vdupq_n_u32(0), 3);
+		for (; i + 16 <= p_len; i += 16) {
+			acc0 = vmlaq_u32(vld1q_u32((const uint32_t *)(p_str + i)), acc0, mul);
+			acc1 = vmlaq_u32(vld1q_u32((const uint32_t *)(p_str + i + 4)), acc1, mul);
+			acc2 = vmlaq_u32(vld1q_u32((const uint32_t *)(p_str + i + 8)), acc2, mul);
+			acc3 = vmlaq_u32(vld1q_u32((const uint32_t *)(p_str + i + 12)), acc3, mul);
+		}
+		vst1q_u32(lanes, acc0);
+		vst1q_u32(lanes + 4, acc1);
+		vst1q_u32(lanes + 8, acc2);
+		vst1q_u32(lanes + 12, acc3);
+#endif
+		static constexpr uint32_t weights[16] = {
+			_pow33(15), _pow33(14), _pow33(13), _pow33(12), _pow33(11), _pow33(10), _pow33(9), _pow33(8),
+			_pow33(7), _pow33(6), _pow33(5), _pow33(4), _pow33(3), _pow33(2), _pow33(1), _pow33(0)
+		};
+		p_hash = 0;
+		for (int k = 0; k < 16; k++) {
+			p_hash += lanes[k] * weights[k];
+		}
+	}
+#endif
+	for (; i < p_len; i++) {
+		p_hash = ((p_hash << 5) + p_hash) + p_str[i]; /* hash * 33 + c */
+	}
+	return p_hash;
+}
@@ -0,0 +1,65 @@
+/**************************************************************************/
+/*  string_simd.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef STRING_SIMD_H
+#define STRING_SIMD_H
+
+#include "core/typedefs.h"
+
+// Vectorized kernels for the hot String loops. They are selected at compile
+// time: SSE2 is part of the x86_64 baseline and NEON of the arm64 one, so no
+// runtime dispatch is needed. Other targets use the scalar loops.
+// Kernels that stop early return how many characters they handled, the
+// caller deals with the character that stopped them.
+class StringSIMD {
+public:
+	// Index of the first occurrence of p_char, or -1.
+	static int find_char(const char32_t *p_str, int p_len, char32_t p_char);
+
+	// Length of the leading run of bytes in [0x01, 0x7f], excluding '\r'.
+	static int ascii_length(const char *p_str, int p_len);
+	// Length of the leading run of characters in [0x00, 0x7f].
+	static int ascii_length(const char32_t *p_str, int p_len);
+
+	// Copy the leading run measured by ascii_length(), widening or narrowing each character.
+	static int widen_ascii(const char *p_src, char32_t *r_dst, int p_len);
+	static int narrow_ascii(const char32_t *p_src, char *r_dst, int p_len);
+
+	// Index of the first character in [p_first, p_last] or above 0x7f, or p_len.
+	static int find_ascii_range(const char32_t *p_str, int p_len, char32_t p_first, char32_t p_last);
+	// Change the case of the leading run of ASCII characters.
+	static int ascii_to_lower(const char32_t *p_src, char32_t *r_dst, int p_len);
+	static int ascii_to_upper(const char32_t *p_src, char32_t *r_dst, int p_len);
+
+	// djb2, continuing from p_hash.
+	static uint32_t hash(const char32_t *p_str, int p_len, uint32_t p_hash = 5381);
+};
+
+#endif // STRING_SIMD_H
@@ -36,6 +36,7 @@
 #include "core/os/memory.h"
 #include "core/string/print_string.h"
 #include "core/string/string_name.h"
+#include "core/string/string_simd.h"
 #include "core/string/translation.h"
 #include "core/string/ucaps.h"
 #include "core/variant/variant.h"
@@ -679,14 +680,7 @@ bool String::operator==(const String &p_str) const {
 	const char32_t *src = get_data();
 	const char32_t *dst = p_str.get_data();
 
-	/* Compare char by char */
-	for (int i = 0; i < l; i++) {
-		if (src[i] != dst[i]) {
-			return false;
-		}
-	}
-
-	return true;
+	return memcmp(src, dst, l * sizeof(char32_t)) == 0;
 }
 
 bool String::operator==(const StrRange &p_str_range) const {
@@ -1447,13 +1441,30 @@ char32_t String::char_lowercase(char32_t p_char) {
 
 String String::to_upper() const {
 	String upper = *this;
+	const int len = length();
+	const char32_t *src = get_data();
 
-	for (int i = 0; i < upper.size(); i++) {
-		const char32_t s = upper[i];
-		const char32_t t = _find_upper(s);
-		if (s != t) { // avoid copy on write
-			upper[i] = t;
+	// Skip what stays unchanged, to avoid copy on write when nothing changes.
+	int i = 0;
+	while (i < len) {
+		i += StringSIMD::find_ascii_range(src + i, len - i, 'a', 'z');
+		if (i < len) {
+			const char32_t t = _find_upper(src[i]);
+			if (t != src[i]) {
+				break;
+			}
 		}
+		i++;
+	}
+	if (i >= len) {
+		return upper;
+	}
+
+	char32_t *dst = upper.ptrw();
+	while (i < len) {
+		dst[i] = _find_upper(src[i]);
+		i++;
+		i += StringSIMD::ascii_to_upper(src + i, dst + i, len - i);
 	}
 
 	return upper;
@@ -1461,13 +1472,30 @@ String String::to_upper() const {
 
 String String::to_lower() const {
 	String lower = *this;
+	const int len = length();
+	const char32_t *src = get_data();
 
-	for (int i = 0; i < lower.size(); i++) {
-		const char32_t s = lower[i];
-		const char32_t t = _find_lower(s);
-		if (s != t) { // avoid copy on write
-			lower[i] = t;
+	// Skip what stays unchanged, to avoid copy on write when nothing changes.
+	int i = 0;
+	while (i < len) {
+		i += StringSIMD::find_ascii_range(src + i, len - i, 'A', 'Z');
+		if (i < len) {
+			const char32_t t = _find_lower(src[i]);
+			if (t != src[i]) {
+				break;
+			}
 		}
+		i++;
+	}
+	if (i >= len) {
+		return lower;
+	}
+
+	char32_t *dst = lower.ptrw();
+	while (i < len) {
+		dst[i] = _find_lower(src[i]);
+		i++;
+		i += StringSIMD::ascii_to_lower(src + i, dst + i, len - i);
 	}
 
 	return lower;
@@ -1806,6 +1834,10 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		}
 	}
 
+	if (p_len < 0) {
+		p_len = strlen(p_utf8);
+	}
+
 	bool decode_error = false;
 	bool decode_failed = false;
 	{
@@ -1817,6 +1849,14 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 			uint8_t c = *ptrtmp >= 0 ? *ptrtmp : uint8_t(256 + *ptrtmp);
 
 			if (skip == 0) {
+				// Plain ASCII needs no validation, count it in bulk.
+				const int ascii = StringSIMD::ascii_length(ptrtmp, ptrtmp_limit - ptrtmp);
+				if (ascii > 0) {
+					str_size += ascii;
+					cstr_size += ascii;
+					ptrtmp += ascii;
+					continue;
+				}
 				if (p_skip_cr && c == '\r') {
 					ptrtmp++;
 					continue;
@@ -1885,6 +1925,13 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		uint8_t c = *p_utf8 >= 0 ? *p_utf8 : uint8_t(256 + *p_utf8);
 
 		if (skip == 0) {
+			const int ascii = StringSIMD::widen_ascii(p_utf8, dst, cstr_size);
+			if (ascii > 0) {
+				dst += ascii;
+				cstr_size -= ascii;
+				p_utf8 += ascii;
+				continue;
+			}
 			if (p_skip_cr && c == '\r') {
 				p_utf8++;
 				continue;
@@ -1965,6 +2012,13 @@ CharString String::utf8() const {
 	const char32_t *d = &operator[](0);
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
+		const int ascii = StringSIMD::ascii_length(d + i, l - i);
+		fl += ascii;
+		i += ascii;
+		if (i == l) {
+			break;
+		}
+
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
 			fl += 1;
@@ -1997,6 +2051,13 @@ CharString String::utf8() const {
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
+		const int ascii = StringSIMD::narrow_ascii(d + i, (char *)cdst, l - i);
+		cdst += ascii;
+		i += ascii;
+		if (i == l) {
+			break;
+		}
+
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
@@ -2805,12 +2866,7 @@ uint32_t String::hash(const wchar_t *p_cstr) {
 }
 
 uint32_t String::hash(const char32_t *p_cstr, int p_len) {
-	uint32_t hashv = 5381;
-	for (int i = 0; i < p_len; i++) {
-		hashv = ((hashv << 5) + hashv) + p_cstr[i]; /* hash * 33 + c */
-	}
-
-	return hashv;
+	return StringSIMD::hash(p_cstr, p_len);
 }
 
 uint32_t String::hash(const char32_t *p_cstr) {
@@ -2828,16 +2884,7 @@ uint32_t String::hash(const char32_t *p_cstr) {
 uint32_t String::hash() const {
 	/* simple djb2 hashing */
 
-	const char32_t *chr = get_data();
-	uint32_t hashv = 5381;
-	uint32_t c = *chr++;
-
-	while (c) {
-		hashv = ((hashv << 5) + hashv) + c; /* hash * 33 + c */
-		c = *chr++;
-	}
-
-	return hashv;
+	return StringSIMD::hash(get_data(), length());
 }
 
 uint64_t String::hash64() const {
@@ -2982,23 +3029,16 @@ int String::find(const String &p_str, int p_from) const {
 	const char32_t *src = get_data();
 	const char32_t *str = p_str.get_data();
 
-	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			if (src[read_pos] != str[j]) {
-				found = false;
-				break;
-			}
+	// Jump between occurrences of the first character, then compare the rest.
+	const int last = len - src_len;
+	for (int i = p_from; i <= last; i++) {
+		const int pos = StringSIMD::find_char(src + i, last - i + 1, str[0]);
+		if (pos < 0) {
+			return -1;
 		}
+		i += pos;
 
-		if (found) {
+		if (memcmp(src + i + 1, str + 1, (src_len - 1) * sizeof(char32_t)) == 0) {
 			return i;
 		}
 	}
@@ -3024,35 +3064,29 @@ int String::find(const char *p_str, int p_from) const {
 		src_len++;
 	}
 
-	if (src_len == 1) {
-		const char32_t needle = p_str[0];
+	if (src_len == 0) {
+		return p_from <= len ? p_from : -1;
+	}
 
-		for (int i = p_from; i < len; i++) {
-			if (src[i] == needle) {
-				return i;
-			}
+	// Jump between occurrences of the first character, then compare the rest.
+	const int last = len - src_len;
+	for (int i = p_from; i <= last; i++) {
+		const int pos = StringSIMD::find_char(src + i, last - i + 1, (char32_t)p_str[0]);
+		if (pos < 0) {
+			return -1;
 		}
+		i += pos;
 
-	} else {
-		for (int i = p_from; i <= (len - src_len); i++) {
-			bool found = true;
-			for (int j = 0; j < src_len; j++) {
-				int read_pos = i + j;
-
-				if (read_pos >= len) {
-					ERR_PRINT("read_pos>=len");
-					return -1;
-				}
-
-				if (src[read_pos] != (char32_t)p_str[j]) {
-					found = false;
-					break;
-				}
+		bool found = true;
+		for (int j = 1; j < src_len; j++) {
+			if (src[i + j] != (char32_t)p_str[j]) {
+				found = false;
+				break;
 			}
+		}
 
-			if (found) {
-				return i;
-			}
+		if (found) {
+			return i;
 		}
 	}
 
@@ -3060,7 +3094,13 @@ int String::find(const char *p_str, int p_from) const {
 }
 
 int String::find_char(const char32_t &p_char, int p_from) const {
-	return _cowdata.find(p_char, p_from);
+	// Like CowData::find(), the search includes the terminating zero.
+	const int size = _cowdata.size();
+	if (p_from < 0 || p_from >= size) {
+		return -1;
+	}
+	const int pos = StringSIMD::find_char(get_data() + p_from, size - p_from, p_char);
+	return pos < 0 ? -1 : p_from + pos;
 }
 
 int String::findmk(const Vector<String> &p_keys, int p_from, int *r_key) const {
@@ -0,0 +1,632 @@
+/**************************************************************************/
+/*  flat_hash_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#include <string.h>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define FLAT_HASH_MAP_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Matches one byte against a group of 16 control bytes at once.
+// Every matching byte sets a bit in the returned mask. With NEON each byte
+// owns a nibble of the mask, only its top bit is kept.
+struct FlatHashGroup {
+	static constexpr uint32_t WIDTH = 16;
+	static constexpr uint8_t EMPTY = 0x80;
+	static constexpr uint8_t DELETED = 0xFE;
+
+#ifdef FLAT_HASH_MAP_NEON
+	static constexpr uint32_t MASK_SHIFT = 2;
+
+	static _FORCE_INLINE_ uint64_t _to_mask(uint8x16_t p_cmp) {
+		const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(p_cmp), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & 0x8888888888888888ull;
+	}
+#else
+	static constexpr uint32_t MASK_SHIFT = 0;
+#endif
+
+	static _FORCE_INLINE_ uint64_t match(const uint8_t *p_ctrl, uint8_t p_byte) {
+#if defined(FLAT_HASH_MAP_SSE2)
+		const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+		return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)p_byte)));
+#elif defined(FLAT_HASH_MAP_NEON)
+		return _to_mask(vceqq_u8(vld1q_u8(p_ctrl), vdupq_n_u8(p_byte)));
+#else
+		uint64_t mask = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			mask |= uint64_t(p_ctrl[i] == p_byte) << i;
+		}
+		return mask;
+#endif
+	}
+
+	static _FORCE_INLINE_ uint64_t match_empty(const uint8_t *p_ctrl) {
+		return match(p_ctrl, EMPTY);
+	}
+
+	// Both EMPTY and DELETED have the top bit set, full slots never do.
+	static _FORCE_INLINE_ uint64_t match_empty_or_deleted(const uint8_t *p_ctrl) {
+#if defined(FLAT_HASH_MAP_SSE2)
+		return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl)));
+#elif defined(FLAT_HASH_MAP_NEON)
+		return _to_mask(vcgeq_u8(vld1q_u8(p_ctrl), vdupq_n_u8(EMPTY)));
+#else
+		uint64_t mask = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			mask |= uint64_t(p_ctrl[i] >> 7) << i;
+		}
+		return mask;
+#endif
+	}
+
+	// Offset in the group of the lowest match, p_mask must not be zero.
+	static _FORCE_INLINE_ uint32_t lowest(uint64_t p_mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+#if defined(_M_X64) || defined(_M_ARM64)
+		_BitScanForward64(&index, p_mask);
+#else
+		if (!_BitScanForward(&index, (unsigned long)p_mask)) {
+			_BitScanForward(&index, (unsigned long)(p_mask >> 32));
+			index += 32;
+		}
+#endif
+		return index >> MASK_SHIFT;
+#else
+		return __builtin_ctzll(p_mask) >> MASK_SHIFT;
+#endif
+	}
+};
+
+/**
+ * A HashMap replacement that uses open addressing in the style of SwissTable.
+ * Every slot of the table has a control byte holding 7 bits of the hash of
+ * its key, so a lookup compares a whole group of 16 slots with one vector
+ * instruction and only touches the keys that match.
+ *
+ * Keys and values are stored inline in an array by insertion order, which is
+ * also the iteration order. The table only holds indices into that array.
+ * Erasing leaves a hole that is skipped during iteration and reclaimed when
+ * the map grows, so the order of the remaining entries is kept.
+ *
+ * Unlike HashMap, inserting may move the entries around in memory. Pointers
+ * and iterators are only valid until the next insertion. Front insertion and
+ * replace_key() are not supported.
+ *
+ * The assignment operator copies the pairs from one map to the other.
+ */
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+public:
+	static constexpr uint32_t MIN_CAPACITY = FlatHashGroup::WIDTH;
+
+private:
+	typedef KeyValue<TKey, TValue> Entry;
+
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+	static constexpr uint32_t MAX_CAPACITY = 1u << 31;
+
+	// Entries by insertion order, with their hash and their slot in the table.
+	// Erased entries have INVALID_INDEX as their slot.
+	Entry *entries = nullptr;
+	uint32_t *entry_hashes = nullptr;
+	uint32_t *entry_slots = nullptr;
+
+	// The table. The first group of control bytes is repeated after the last
+	// one, so a group can be loaded from any slot without wrapping around.
+	uint8_t *ctrl = nullptr;
+	uint32_t *slot_entries = nullptr;
+
+	uint32_t capacity = MIN_CAPACITY;
+	uint32_t num_used = 0;
+	uint32_t num_elements = 0;
+
+	// The table is kept at most 7/8 full, tombstones included. Every used
+	// entry owns one full or deleted slot, so limiting the entries is enough.
+	static _FORCE_INLINE_ uint32_t _get_max_entries(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8;
+	}
+
+	static _FORCE_INLINE_ uint32_t _hash(const TKey &p_key) {
+		// Mixed, since the control bytes and the probe start use different bits.
+		return hash_fmix32(Hasher::hash(p_key));
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_slot, uint8_t p_value) {
+		ctrl[p_slot] = p_value;
+		if (p_slot < FlatHashGroup::WIDTH) {
+			ctrl[capacity + p_slot] = p_value;
+		}
+	}
+
+	uint32_t _lookup_index(const TKey &p_key, uint32_t p_hash) const {
+		if (ctrl == nullptr || num_elements == 0) {
+			return INVALID_INDEX;
+		}
+
+		const uint8_t h2 = p_hash & 0x7F;
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			const uint8_t *group = ctrl + pos;
+			uint64_t matches = FlatHashGroup::match(group, h2);
+			while (matches) {
+				const uint32_t index = slot_entries[(pos + FlatHashGroup::lowest(matches)) & mask];
+				if (entry_hashes[index] == p_hash && Comparator::compare(entries[index].key, p_key)) {
+					return index;
+				}
+				matches &= matches - 1;
+			}
+
+			if (FlatHashGroup::match_empty(group)) {
+				return INVALID_INDEX;
+			}
+
+			// Triangular probing over groups, this visits every group.
+			step += FlatHashGroup::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	uint32_t _find_free_slot(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = (p_hash >> 7) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			const uint64_t free = FlatHashGroup::match_empty_or_deleted(ctrl + pos);
+			if (free) {
+				return (pos + FlatHashGroup::lowest(free)) & mask;
+			}
+
+			step += FlatHashGroup::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	void _allocate() {
+		const uint32_t max_entries = _get_max_entries(capacity);
+
+		ctrl = reinterpret_cast<uint8_t *>(Memory::alloc_static(capacity + FlatHashGroup::WIDTH));
+		slot_entries = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
+		entries = reinterpret_cast<Entry *>(Memory::alloc_static(sizeof(Entry) * max_entries));
+		entry_hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * max_entries));
+		entry_slots = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * max_entries));
+
+		memset(ctrl, FlatHashGroup::EMPTY, capacity + FlatHashGroup::WIDTH);
+	}
+
+	void _free() {
+		Memory::free_static(ctrl);
+		Memory::free_static(slot_entries);
+		Memory::free_static(entries);
+		Memory::free_static(entry_hashes);
+		Memory::free_static(entry_slots);
+		ctrl = nullptr;
+	}
+
+	// Moves the entries to a table of p_capacity slots, dropping the holes
+	// left by erased entries.
+	void _resize_and_rehash(uint32_t p_capacity) {
+		uint8_t *old_ctrl = ctrl;
+		uint32_t *old_slot_entries = slot_entries;
+		Entry *old_entries = entries;
+		uint32_t *old_entry_hashes = entry_hashes;
+		uint32_t *old_entry_slots = entry_slots;
+		const uint32_t old_used = num_used;
+
+		capacity = p_capacity;
+		_allocate();
+		num_used = 0;
+
+		for (uint32_t i = 0; i < old_used; i++) {
+			if (old_entry_slots[i] == INVALID_INDEX) {
+				continue;
+			}
+
+			const uint32_t hash = old_entry_hashes[i];
+			const uint32_t slot = _find_free_slot(hash);
+			_set_ctrl(slot, hash & 0x7F);
+			slot_entries[slot] = num_used;
+
+			memnew_placement(&entries[num_used], Entry(old_entries[i]));
+			old_entries[i].~Entry();
+			entry_hashes[num_used] = hash;
+			entry_slots[num_used] = slot;
+			num_used++;
+		}
+
+		Memory::free_static(old_ctrl);
+		Memory::free_static(old_slot_entries);
+		Memory::free_static(old_entries);
+		Memory::free_static(old_entry_hashes);
+		Memory::free_static(old_entry_slots);
+	}
+
+	_FORCE_INLINE_ Entry *_emplace(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		const uint32_t slot = _find_free_slot(p_hash);
+		_set_ctrl(slot, p_hash & 0x7F);
+		slot_entries[slot] = num_used;
+
+		Entry *entry = &entries[num_used];
+		memnew_placement(entry, Entry(p_key, p_value));
+		entry_hashes[num_used] = p_hash;
+		entry_slots[num_used] = slot;
+		num_used++;
+		num_elements++;
+		return entry;
+	}
+
+	// p_key must not be in the map yet.
+	Entry *_insert_new(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(ctrl == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate();
+		} else if (unlikely(num_used == _get_max_entries(capacity))) {
+			// Reclaim the holes in place if erasing freed up enough room, grow otherwise.
+			uint32_t new_capacity = capacity;
+			if (num_elements >= _get_max_entries(capacity) / 2) {
+				ERR_FAIL_COND_V_MSG(capacity == MAX_CAPACITY, nullptr, "Hash table maximum capacity reached, aborting insertion.");
+				new_capacity = capacity * 2;
+			}
+
+			// The key or the value may be stored in this map, copy them before moving it.
+			const Entry entry(p_key, p_value);
+			_resize_and_rehash(new_capacity);
+			return _emplace(entry.key, entry.value, p_hash);
+		}
+
+		return _emplace(p_key, p_value, p_hash);
+	}
+
+	void _erase_index(uint32_t p_index) {
+		_set_ctrl(entry_slots[p_index], FlatHashGroup::DELETED);
+		entry_slots[p_index] = INVALID_INDEX;
+		entries[p_index].~Entry();
+		num_elements--;
+
+		if (num_elements == 0) {
+			// Nothing left to probe past, start over without tombstones.
+			memset(ctrl, FlatHashGroup::EMPTY, capacity + FlatHashGroup::WIDTH);
+			num_used = 0;
+		}
+	}
+
+	_FORCE_INLINE_ uint32_t _next_index(uint32_t p_from) const {
+		for (uint32_t i = p_from; i < num_used; i++) {
+			if (entry_slots[i] != INVALID_INDEX) {
+				return i;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+	_FORCE_INLINE_ uint32_t _prev_index(uint32_t p_from) const {
+		for (uint32_t i = MIN(p_from, num_used); i > 0; i--) {
+			if (entry_slots[i - 1] != INVALID_INDEX) {
+				return i - 1;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr || num_used == 0) {
+			return;
+		}
+
+		if constexpr (!std::is_trivially_destructible_v<Entry>) {
+			for (uint32_t i = 0; i < num_used; i++) {
+				if (entry_slots[i] != INVALID_INDEX) {
+					entries[i].~Entry();
+				}
+			}
+		}
+
+		memset(ctrl, FlatHashGroup::EMPTY, capacity + FlatHashGroup::WIDTH);
+		num_used = 0;
+		num_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, _hash(p_key));
+		CRASH_COND_MSG(index == INVALID_INDEX, "FlatHashMap key not found.");
+		return entries[index].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, _hash(p_key));
+		CRASH_COND_MSG(index == INVALID_INDEX, "FlatHashMap key not found.");
+		return entries[index].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, _hash(p_key));
+		if (index != INVALID_INDEX) {
+			return &entries[index].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, _hash(p_key));
+		if (index != INVALID_INDEX) {
+			return &entries[index].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _lookup_index(p_key, _hash(p_key)) != INVALID_INDEX;
+	}
+
+	bool erase(const TKey &p_key) {
+		const uint32_t index = _lookup_index(p_key, _hash(p_key));
+		if (index == INVALID_INDEX) {
+			return false;
+		}
+
+		_erase_index(index);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = capacity;
+		while (_get_max_entries(new_capacity) < p_new_capacity) {
+			ERR_FAIL_COND_MSG(new_capacity == MAX_CAPACITY, "Hash table maximum capacity reached, aborting reserve.");
+			new_capacity *= 2;
+		}
+
+		if (new_capacity == capacity) {
+			return;
+		}
+
+		if (ctrl == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->entries[index];
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->entries[index]; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (index != INVALID_INDEX) {
+				index = map->_next_index(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (index != INVALID_INDEX) {
+				index = map->_prev_index(index);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index != INVALID_INDEX;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const FlatHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const FlatHashMap *map = nullptr;
+		uint32_t index = INVALID_INDEX;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->entries[index];
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->entries[index]; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (index != INVALID_INDEX) {
+				index = map->_next_index(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (index != INVALID_INDEX) {
+				index = map->_prev_index(index);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index != INVALID_INDEX;
+		}
+
+		_FORCE_INLINE_ Iterator(FlatHashMap *p_map, uint32_t p_index) {
+			map = p_map;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, index);
+		}
+
+	private:
+		FlatHashMap *map = nullptr;
+		uint32_t index = INVALID_INDEX;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _next_index(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, INVALID_INDEX);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(this, _prev_index(num_used));
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		return Iterator(this, _lookup_index(p_key, _hash(p_key)));
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _next_index(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, INVALID_INDEX);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(this, _prev_index(num_used));
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		return ConstIterator(this, _lookup_index(p_key, _hash(p_key)));
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		const uint32_t index = _lookup_index(p_key, _hash(p_key));
+		CRASH_COND(index == INVALID_INDEX);
+		return entries[index].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = _hash(p_key);
+		const uint32_t index = _lookup_index(p_key, hash);
+		if (index == INVALID_INDEX) {
+			return _insert_new(p_key, TValue(), hash)->value;
+		} else {
+			return entries[index].value;
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = _hash(p_key);
+		const uint32_t index = _lookup_index(p_key, hash);
+		if (index != INVALID_INDEX) {
+			entries[index].value = p_value;
+			return Iterator(this, index);
+		}
+
+		const Entry *entry = _insert_new(p_key, p_value, hash);
+		return Iterator(this, entry ? uint32_t(entry - entries) : INVALID_INDEX);
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		reserve(p_other.num_elements);
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+
+		reserve(p_other.num_elements);
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	FlatHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashMap() {}
+
+	~FlatHashMap() {
+		clear();
+
+		if (ctrl != nullptr) {
+			_free();
+		}
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
@@ -96,14 +96,19 @@ private:
 		return fastmod(p_pos - original_pos + p_capacity, p_capacity_inv, p_capacity);
 	}
 
-	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+	_FORCE_INLINE_ bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		return _lookup_pos_with_hash<Comparator>(p_key, _hash(p_key), r_pos);
+	}
+
+	template <class LookupComparator, class TLookupKey>
+	bool _lookup_pos_with_hash(const TLookupKey &p_key, uint32_t p_hash, uint32_t &r_pos) const {
 		if (elements == nullptr || num_elements == 0) {
 			return false; // Failed lookups, no elements
 		}
 
 		const uint32_t capacity = hash_table_size_primes[capacity_index];
 		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
-		uint32_t hash = _hash(p_key);
+		uint32_t hash = p_hash;
 		uint32_t pos = fastmod(hash, capacity_inv, capacity);
 		uint32_t distance = 0;
 
@@ -116,7 +121,7 @@ private:
 				return false;
 			}
 
-			if (hashes[pos] == hash && Comparator::compare(elements[pos]->data.key, p_key)) {
+			if (hashes[pos] == hash && LookupComparator::compare(elements[pos]->data.key, p_key)) {
 				r_pos = pos;
 				return true;
 			}
@@ -305,6 +310,31 @@ public:
 		return nullptr;
 	}
 
+	// Looks up a key of another type without converting it to TKey first.
+	// p_hash must be what Hasher returns for the equivalent TKey, and
+	// LookupComparator::compare(const TKey &, const TLookupKey &) must agree with Comparator.
+	template <class LookupComparator, class TLookupKey>
+	const TValue *getptr_with_hash(const TLookupKey &p_key, uint32_t p_hash) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos_with_hash<LookupComparator>(p_key, unlikely(p_hash == EMPTY_HASH) ? EMPTY_HASH + 1 : p_hash, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	template <class LookupComparator, class TLookupKey>
+	TValue *getptr_with_hash(const TLookupKey &p_key, uint32_t p_hash) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos_with_hash<LookupComparator>(p_key, unlikely(p_hash == EMPTY_HASH) ? EMPTY_HASH + 1 : p_hash, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
 	_FORCE_INLINE_ bool has(const TKey &p_key) const {
 		uint32_t _pos = 0;
 		return _lookup_pos(p_key, _pos);
@@ -43,6 +43,21 @@ struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
 	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
+
+	// StringName keys are stored as String, a name matches either.
+	struct NamedKeyComparator {
+		static _FORCE_INLINE_ bool compare(const Variant &p_key, const StringName &p_name) {
+			if (p_key.get_type() == Variant::STRING) {
+				return *VariantInternal::get_string(&p_key) == p_name;
+			}
+			return p_key.get_type() == Variant::STRING_NAME && *VariantInternal::get_string_name(&p_key) == p_name;
+		}
+	};
+
+	_FORCE_INLINE_ Variant *getptr_named(const StringName &p_name) {
+		// The hash of a name is the hash of its String, except for the empty name.
+		return variant_map.getptr_with_hash<NamedKeyComparator>(p_name, p_name ? p_name.hash() : String().hash());
+	}
 };
 
 void Dictionary::get_key_list(List<Variant> *p_keys) const {
@@ -81,24 +96,23 @@ Variant Dictionary::get_value_at_index(int p_index) const {
 
 Variant &Dictionary::operator[](const Variant &p_key) {
 	if (unlikely(_p->read_only)) {
+		const Variant *value;
 		if (p_key.get_type() == Variant::STRING_NAME) {
-			const StringName *sn = VariantInternal::get_string_name(&p_key);
-			const String &key = sn->operator String();
-			if (likely(_p->variant_map.has(key))) {
-				*_p->read_only = _p->variant_map[key];
-			} else {
-				*_p->read_only = Variant();
-			}
-		} else if (likely(_p->variant_map.has(p_key))) {
-			*_p->read_only = _p->variant_map[p_key];
+			value = _p->getptr_named(*VariantInternal::get_string_name(&p_key));
 		} else {
-			*_p->read_only = Variant();
+			value = _p->variant_map.getptr(p_key);
 		}
+		*_p->read_only = likely(value) ? *value : Variant();
 
 		return *_p->read_only;
 	} else {
 		if (p_key.get_type() == Variant::STRING_NAME) {
 			const StringName *sn = VariantInternal::get_string_name(&p_key);
+			// Only make a String out of the name when it has to be inserted.
+			Variant *value = _p->getptr_named(*sn);
+			if (likely(value)) {
+				return *value;
+			}
 			return _p->variant_map[sn->operator String()];
 		} else {
 			return _p->variant_map[p_key];
@@ -112,6 +126,9 @@ const Variant &Dictionary::operator[](const Variant &p_key) const {
 }
 
 const Variant *Dictionary::getptr(const Variant &p_key) const {
+	if (p_key.get_type() == Variant::STRING_NAME) {
+		return _p->getptr_named(*VariantInternal::get_string_name(&p_key));
+	}
 	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(p_key));
 	if (!E) {
 		return nullptr;
@@ -120,16 +137,34 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 }
 
 Variant *Dictionary::getptr(const Variant &p_key) {
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(p_key));
-	if (!E) {
+	Variant *value;
+	if (p_key.get_type() == Variant::STRING_NAME) {
+		value = _p->getptr_named(*VariantInternal::get_string_name(&p_key));
+	} else {
+		value = _p->variant_map.getptr(p_key);
+	}
+	if (!value) {
 		return nullptr;
 	}
 	if (unlikely(_p->read_only != nullptr)) {
-		*_p->read_only = E->value;
+		*_p->read_only = *value;
 		return _p->read_only;
 	} else {
-		return &E->value;
+		return value;
+	}
+}
+
+const Variant *Dictionary::getptr_named(const StringName &p_key) const {
+	return _p->getptr_named(p_key);
+}
+
+Variant *Dictionary::getptr_named(const StringName &p_key) {
+	Variant *value = _p->getptr_named(p_key);
+	if (unlikely(value && _p->read_only != nullptr)) {
+		*_p->read_only = *value;
+		return _p->read_only;
 	}
+	return value;
 }
 
 Variant Dictionary::get_valid(const Variant &p_key) const {
@@ -159,9 +194,16 @@ bool Dictionary::is_empty() const {
 }
 
 bool Dictionary::has(const Variant &p_key) const {
+	if (p_key.get_type() == Variant::STRING_NAME) {
+		return _p->getptr_named(*VariantInternal::get_string_name(&p_key)) != nullptr;
+	}
 	return _p->variant_map.has(p_key);
 }
 
+bool Dictionary::has_named(const StringName &p_key) const {
+	return _p->getptr_named(p_key) != nullptr;
+}
+
 bool Dictionary::has_all(const Array &p_keys) const {
 	for (int i = 0; i < p_keys.size(); i++) {
 		if (!has(p_keys[i])) {
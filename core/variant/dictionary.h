@@ -56,6 +56,10 @@ public:
 	const Variant *getptr(const Variant &p_key) const;
 	Variant *getptr(const Variant &p_key);
 
+	// Look up a String or StringName key without wrapping it in a Variant.
+	const Variant *getptr_named(const StringName &p_key) const;
+	Variant *getptr_named(const StringName &p_key);
+
 	Variant get_valid(const Variant &p_key) const;
 	Variant get(const Variant &p_key, const Variant &p_default) const;
 
@@ -65,6 +69,7 @@ public:
 	void merge(const Dictionary &p_dictionary, bool p_overwrite = false);
 
 	bool has(const Variant &p_key) const;
+	bool has_named(const StringName &p_key) const;
 	bool has_all(const Array &p_keys) const;
 	Variant find_key(const Variant &p_value) const;
 
@@ -37,6 +37,7 @@
 #include "core/io/resource.h"
 #include "core/math/math_funcs.h"
 #include "core/string/print_string.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small;
@@ -2194,11 +2195,27 @@ inline DA _convert_array(const SA &p_array) {
 	return da;
 }
 
+template <class DA>
+struct _ArrayConverter {
+	static DA from_array(const Array &p_array) {
+		return _convert_array<DA, Array>(p_array);
+	}
+};
+
+template <class T>
+struct _ArrayConverter<Vector<T>> {
+	static Vector<T> from_array(const Array &p_array) {
+		Vector<T> packed;
+		VariantPackedArrayFromArray::convert(p_array, packed);
+		return packed;
+	}
+};
+
 template <class DA>
 inline DA _convert_array_from_variant(const Variant &p_variant) {
 	switch (p_variant.get_type()) {
 		case Variant::ARRAY: {
-			return _convert_array<DA, Array>(p_variant.operator Array());
+			return _ArrayConverter<DA>::from_array(*VariantInternal::get_array(&p_variant));
 		}
 		case Variant::PACKED_BYTE_ARRAY: {
 			return _convert_array<DA, Vector<uint8_t>>(p_variant.operator Vector<uint8_t>());
@@ -35,6 +35,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/math_simd.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/local_vector.h"
@@ -1019,6 +1020,190 @@ struct _VariantCall {
 		return len;
 	}
 
+	// Bulk math on packed float and vector arrays, see MathSIMD. Vector arrays
+	// are handled as flat arrays of their components.
+	template <class T>
+	static _FORCE_INLINE_ real_t *_packed_components_w(Vector<T> *p_instance) {
+		return reinterpret_cast<real_t *>(p_instance->ptrw());
+	}
+
+	template <class T>
+	static _FORCE_INLINE_ const real_t *_packed_components(const Vector<T> *p_instance) {
+		return reinterpret_cast<const real_t *>(p_instance->ptr());
+	}
+
+	static void func_PackedFloat32Array_add(PackedFloat32Array *p_instance, float p_value) {
+		MathSIMD::add(p_instance->ptrw(), p_instance->size(), &p_value, 1);
+	}
+
+	static void func_PackedFloat32Array_multiply(PackedFloat32Array *p_instance, float p_value) {
+		MathSIMD::multiply(p_instance->ptrw(), p_instance->size(), &p_value, 1);
+	}
+
+	static void func_PackedFloat32Array_clamp(PackedFloat32Array *p_instance, float p_min, float p_max) {
+		MathSIMD::clamp(p_instance->ptrw(), p_instance->size(), &p_min, &p_max, 1);
+	}
+
+	static void func_PackedFloat32Array_add_array(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::add_array(p_instance->ptrw(), p_array.ptr(), p_instance->size());
+	}
+
+	static void func_PackedFloat32Array_multiply_array(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::multiply_array(p_instance->ptrw(), p_array.ptr(), p_instance->size());
+	}
+
+	static void func_PackedFloat32Array_lerp_array(PackedFloat32Array *p_instance, const PackedFloat32Array &p_to, float p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::lerp_array(p_instance->ptrw(), p_to.ptr(), p_instance->size(), p_weight);
+	}
+
+	static double func_PackedFloat32Array_sum(PackedFloat32Array *p_instance) {
+		float result = 0;
+		if (!p_instance->is_empty()) {
+			MathSIMD::sum(p_instance->ptr(), p_instance->size(), 1, &result);
+		}
+		return result;
+	}
+
+	static double func_PackedFloat32Array_min(PackedFloat32Array *p_instance) {
+		float result = 0;
+		if (!p_instance->is_empty()) {
+			MathSIMD::min(p_instance->ptr(), p_instance->size(), 1, &result);
+		}
+		return result;
+	}
+
+	static double func_PackedFloat32Array_max(PackedFloat32Array *p_instance) {
+		float result = 0;
+		if (!p_instance->is_empty()) {
+			MathSIMD::max(p_instance->ptr(), p_instance->size(), 1, &result);
+		}
+		return result;
+	}
+
+	static double func_PackedFloat32Array_dot(PackedFloat32Array *p_instance, const PackedFloat32Array &p_array) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0, "Both arrays must have the same size.");
+		return MathSIMD::dot(p_instance->ptr(), p_array.ptr(), p_instance->size());
+	}
+
+	static void func_PackedFloat32Array_prefix_sum(PackedFloat32Array *p_instance) {
+		MathSIMD::prefix_sum(p_instance->ptrw(), p_instance->size());
+	}
+
+	static void func_PackedVector2Array_add(PackedVector2Array *p_instance, const Vector2 &p_value) {
+		MathSIMD::add(_packed_components_w(p_instance), p_instance->size() * 2, p_value.coord, 2);
+	}
+
+	static void func_PackedVector2Array_multiply(PackedVector2Array *p_instance, const Vector2 &p_value) {
+		MathSIMD::multiply(_packed_components_w(p_instance), p_instance->size() * 2, p_value.coord, 2);
+	}
+
+	static void func_PackedVector2Array_clamp(PackedVector2Array *p_instance, const Vector2 &p_min, const Vector2 &p_max) {
+		MathSIMD::clamp(_packed_components_w(p_instance), p_instance->size() * 2, p_min.coord, p_max.coord, 2);
+	}
+
+	static void func_PackedVector2Array_add_array(PackedVector2Array *p_instance, const PackedVector2Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::add_array(_packed_components_w(p_instance), _packed_components(&p_array), p_instance->size() * 2);
+	}
+
+	static void func_PackedVector2Array_multiply_array(PackedVector2Array *p_instance, const PackedVector2Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::multiply_array(_packed_components_w(p_instance), _packed_components(&p_array), p_instance->size() * 2);
+	}
+
+	static void func_PackedVector2Array_lerp_array(PackedVector2Array *p_instance, const PackedVector2Array &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::lerp_array(_packed_components_w(p_instance), _packed_components(&p_to), p_instance->size() * 2, (real_t)p_weight);
+	}
+
+	static Vector2 func_PackedVector2Array_sum(PackedVector2Array *p_instance) {
+		Vector2 result;
+		if (!p_instance->is_empty()) {
+			MathSIMD::sum(_packed_components(p_instance), p_instance->size() * 2, 2, result.coord);
+		}
+		return result;
+	}
+
+	static Vector2 func_PackedVector2Array_min(PackedVector2Array *p_instance) {
+		Vector2 result;
+		if (!p_instance->is_empty()) {
+			MathSIMD::min(_packed_components(p_instance), p_instance->size() * 2, 2, result.coord);
+		}
+		return result;
+	}
+
+	static Vector2 func_PackedVector2Array_max(PackedVector2Array *p_instance) {
+		Vector2 result;
+		if (!p_instance->is_empty()) {
+			MathSIMD::max(_packed_components(p_instance), p_instance->size() * 2, 2, result.coord);
+		}
+		return result;
+	}
+
+	static void func_PackedVector2Array_transform(PackedVector2Array *p_instance, const Transform2D &p_transform) {
+		Vector2 *w = p_instance->ptrw();
+		MathSIMD::transform(w, w, p_instance->size(), p_transform);
+	}
+
+	static void func_PackedVector3Array_add(PackedVector3Array *p_instance, const Vector3 &p_value) {
+		MathSIMD::add(_packed_components_w(p_instance), p_instance->size() * 3, p_value.coord, 3);
+	}
+
+	static void func_PackedVector3Array_multiply(PackedVector3Array *p_instance, const Vector3 &p_value) {
+		MathSIMD::multiply(_packed_components_w(p_instance), p_instance->size() * 3, p_value.coord, 3);
+	}
+
+	static void func_PackedVector3Array_clamp(PackedVector3Array *p_instance, const Vector3 &p_min, const Vector3 &p_max) {
+		MathSIMD::clamp(_packed_components_w(p_instance), p_instance->size() * 3, p_min.coord, p_max.coord, 3);
+	}
+
+	static void func_PackedVector3Array_add_array(PackedVector3Array *p_instance, const PackedVector3Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::add_array(_packed_components_w(p_instance), _packed_components(&p_array), p_instance->size() * 3);
+	}
+
+	static void func_PackedVector3Array_multiply_array(PackedVector3Array *p_instance, const PackedVector3Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::multiply_array(_packed_components_w(p_instance), _packed_components(&p_array), p_instance->size() * 3);
+	}
+
+	static void func_PackedVector3Array_lerp_array(PackedVector3Array *p_instance, const PackedVector3Array &p_to, double p_weight) {
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");
+		MathSIMD::lerp_array(_packed_components_w(p_instance), _packed_components(&p_to), p_instance->size() * 3, (real_t)p_weight);
+	}
+
+	static Vector3 func_PackedVector3Array_sum(PackedVector3Array *p_instance) {
+		Vector3 result;
+		if (!p_instance->is_empty()) {
+			MathSIMD::sum(_packed_components(p_instance), p_instance->size() * 3, 3, result.coord);
+		}
+		return result;
+	}
+
+	static Vector3 func_PackedVector3Array_min(PackedVector3Array *p_instance) {
+		Vector3 result;
+		if (!p_instance->is_empty()) {
+			MathSIMD::min(_packed_components(p_instance), p_instance->size() * 3, 3, result.coord);
+		}
+		return result;
+	}
+
+	static Vector3 func_PackedVector3Array_max(PackedVector3Array *p_instance) {
+		Vector3 result;
+		if (!p_instance->is_empty()) {
+			MathSIMD::max(_packed_components(p_instance), p_instance->size() * 3, 3, result.coord);
+		}
+		return result;
+	}
+
+	static void func_PackedVector3Array_transform(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		Vector3 *w = p_instance->ptrw();
+		MathSIMD::transform(w, w, p_instance->size(), p_transform);
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2383,6 +2568,17 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, add, _VariantCall::func_PackedFloat32Array_add, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, multiply, _VariantCall::func_PackedFloat32Array_multiply, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloat32Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat32Array, add_array, _VariantCall::func_PackedFloat32Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_array, _VariantCall::func_PackedFloat32Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, lerp_array, _VariantCall::func_PackedFloat32Array_lerp_array, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloat32Array_dot, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, prefix_sum, _VariantCall::func_PackedFloat32Array_prefix_sum, sarray(), varray());
 
 	/* Float64 Array */
 
@@ -2455,6 +2651,16 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, add, _VariantCall::func_PackedVector2Array_add, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, multiply, _VariantCall::func_PackedVector2Array_multiply, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, clamp, _VariantCall::func_PackedVector2Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedVector2Array, add_array, _VariantCall::func_PackedVector2Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, multiply_array, _VariantCall::func_PackedVector2Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, lerp_array, _VariantCall::func_PackedVector2Array_lerp_array, sarray("to", "weight"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_PackedVector2Array_sum, sarray(), varray());
+	bind_function(PackedVector2Array, min, _VariantCall::func_PackedVector2Array_min, sarray(), varray());
+	bind_function(PackedVector2Array, max, _VariantCall::func_PackedVector2Array_max, sarray(), varray());
+	bind_functionnc(PackedVector2Array, transform, _VariantCall::func_PackedVector2Array_transform, sarray("transform"), varray());
 
 	/* Vector3 Array */
 
@@ -2479,6 +2685,16 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, add, _VariantCall::func_PackedVector3Array_add, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, multiply, _VariantCall::func_PackedVector3Array_multiply, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, clamp, _VariantCall::func_PackedVector3Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedVector3Array, add_array, _VariantCall::func_PackedVector3Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply_array, _VariantCall::func_PackedVector3Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, lerp_array, _VariantCall::func_PackedVector3Array_lerp_array, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVector3Array_sum, sarray(), varray());
+	bind_function(PackedVector3Array, min, _VariantCall::func_PackedVector3Array_min, sarray(), varray());
+	bind_function(PackedVector3Array, max, _VariantCall::func_PackedVector3Array_max, sarray(), varray());
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
 
 	/* Color Array */
 
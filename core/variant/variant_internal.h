@@ -1070,6 +1070,26 @@ struct VariantInternalAccessor<Variant> {
 	static _FORCE_INLINE_ void set(Variant *v, const Variant &p_value) { *v = p_value; }
 };
 
+// Fills a packed array from an Array. Elements that already have the packed
+// element type, as in a typed Array of that type, are read in place, the
+// others go through the regular Variant conversion.
+struct VariantPackedArrayFromArray {
+	template <class T>
+	static void convert(const Array &p_array, Vector<T> &r_packed) {
+		const int size = p_array.size();
+		r_packed.resize(size);
+		T *w = r_packed.ptrw();
+		for (int i = 0; i < size; i++) {
+			const Variant &v = p_array[i];
+			if (likely(v.get_type() == GetTypeInfo<T>::VARIANT_TYPE)) {
+				w[i] = VariantInternalAccessor<T>::get(&v);
+			} else {
+				w[i] = v;
+			}
+		}
+	}
+};
+
 template <>
 struct VariantInternalAccessor<Vector<Variant>> {
 	static _FORCE_INLINE_ Vector<Variant> get(const Variant *v) {
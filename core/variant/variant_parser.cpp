@@ -272,7 +272,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
-				String str;
+				StringBuffer<> str;
 				char32_t prev = 0;
 				while (true) {
 					char32_t ch = p_stream->get_char();
@@ -375,6 +375,12 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
+						// StringBuffer does not validate, do what String would do.
+						if (res == 0) {
+							continue;
+						} else if (res > 0x10ffff) {
+							res = 0xfffd;
+						}
 						str += res;
 					} else {
 						if (prev != 0) {
@@ -394,15 +400,16 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
+				String value = str.as_string();
 				if (p_stream->is_utf8()) {
-					str.parse_utf8(str.ascii(true).get_data());
+					value.parse_utf8(value.ascii(true).get_data());
 				}
 				if (string_name) {
 					r_token.type = TK_STRING_NAME;
-					r_token.value = StringName(str);
+					r_token.value = StringName(value);
 				} else {
 					r_token.type = TK_STRING;
-					r_token.value = str;
+					r_token.value = value;
 				}
 				return OK;
 
@@ -1517,7 +1524,7 @@ Error VariantParser::_parse_tag(Token &token, Stream *p_stream, int &line, Strin
 				} else {
 					escaping = false;
 				}
-				r_tag.name += String::chr(c);
+				r_tag.name += c;
 			}
 		}
 
@@ -1661,7 +1668,7 @@ Error VariantParser::parse_tag_assign_eof(Stream *p_stream, int &line, String &r
 				what = tk.value;
 
 			} else if (c != '=') {
-				what += String::chr(c);
+				what += c;
 			} else {
 				r_assign = what;
 				Token token;
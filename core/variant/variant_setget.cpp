@@ -249,7 +249,7 @@ void Variant::set_named(const StringName &p_member, const Variant &p_value, bool
 			return;
 		}
 	} else if (type == Variant::DICTIONARY) {
-		Variant *v = VariantGetInternalPtr<Dictionary>::get_ptr(this)->getptr(p_member);
+		Variant *v = VariantGetInternalPtr<Dictionary>::get_ptr(this)->getptr_named(p_member);
 		if (v) {
 			*v = p_value;
 			r_valid = true;
@@ -286,7 +286,7 @@ Variant Variant::get_named(const StringName &p_member, bool &r_valid) const {
 			return obj->get(p_member, &r_valid);
 		}
 	} else if (type == Variant::DICTIONARY) {
-		const Variant *v = VariantGetInternalPtr<Dictionary>::get_ptr(this)->getptr(p_member);
+		const Variant *v = VariantGetInternalPtr<Dictionary>::get_ptr(this)->getptr_named(p_member);
 		if (v) {
 			r_valid = true;
 
@@ -44,10 +44,13 @@
 #include "core/io/file_access_pack.h"
 #include "core/io/file_access_zip.h"
 #include "core/io/image_loader.h"
+#include "core/io/json.h"
 #include "core/io/ip.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
+#include "core/os/small_allocator.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
 #include "core/string/translation.h"
@@ -209,6 +212,7 @@ static bool debug_collisions = false;
 static bool debug_paths = false;
 static bool debug_navigation = false;
 static bool debug_avoidance = false;
+static String memory_tags_dump_path;
 #endif
 static int max_fps = -1;
 static int frame_delay = 0;
@@ -280,6 +284,30 @@ static Vector<String> get_files_with_extension(const String &p_root, const Strin
 }
 #endif
 
+#ifdef DEBUG_ENABLED
+// Writes the memory usage of each Memory::Tag as JSON, so runs of different builds can be diffed.
+static void dump_memory_tags(const String &p_path) {
+	Dictionary tags;
+	for (int i = 0; i < Memory::TAG_MAX; i++) {
+		const Memory::Tag tag = Memory::Tag(i);
+		Dictionary info;
+		info["usage"] = Memory::get_tag_usage(tag);
+		info["max_usage"] = Memory::get_tag_max_usage(tag);
+		info["alloc_count"] = Memory::get_tag_alloc_count(tag);
+		tags[Memory::get_tag_name(tag)] = info;
+	}
+	Dictionary dump;
+	dump["usage"] = Memory::get_mem_usage();
+	dump["max_usage"] = Memory::get_mem_max_usage();
+	dump["frames"] = Engine::get_singleton()->get_process_frames();
+	dump["tags"] = tags;
+
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(f.is_null(), "Can't open file to dump memory tags: " + p_path);
+	f->store_string(JSON::stringify(dump, "\t", true));
+}
+#endif
+
 // FIXME: Could maybe be moved to have less code in main.cpp.
 void initialize_physics() {
 	/// 3D Physics Server
@@ -471,6 +499,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --debug-navigation                Show navigation polygons when running the scene.\n");
 	OS::get_singleton()->print("  --debug-avoidance                 Show navigation avoidance debug visuals when running the scene.\n");
 	OS::get_singleton()->print("  --debug-stringnames               Print all StringName allocations to stdout when the engine quits.\n");
+	OS::get_singleton()->print("  --dump-memory-tags <file>         Write the memory usage of each allocation tag as JSON to <file> when the main loop exits.\n");
 #endif
 	OS::get_singleton()->print("  --max-fps <fps>                   Set a maximum number of frames per second rendered (can be used to limit power usage). A value of 0 results in unlimited framerate.\n");
 	OS::get_singleton()->print("  --frame-delay <ms>                Simulate high CPU load (delay each frame by <ms> milliseconds). Do not use as a FPS limiter; use --max-fps instead.\n");
@@ -1419,6 +1448,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			debug_avoidance = true;
 		} else if (I->get() == "--debug-stringnames") {
 			StringName::set_debug_stringnames(true);
+		} else if (I->get() == "--dump-memory-tags") {
+			if (I->next()) {
+				memory_tags_dump_path = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing file argument for --dump-memory-tags <file>.\n");
+				goto error;
+			}
 #endif
 		} else if (I->get() == "--remote-debug") {
 			if (I->next()) {
@@ -3540,6 +3577,8 @@ bool Main::iteration() {
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
+	FrameArena::end_frame();
+
 	if (frame > 1000000) {
 		// Wait a few seconds before printing FPS, as FPS reporting just after the engine has started is inaccurate.
 		if (hide_print_fps_attempts == 0) {
@@ -3581,6 +3620,12 @@ bool Main::iteration() {
 		exit = true;
 	}
 
+#ifdef DEBUG_ENABLED
+	if (exit && !memory_tags_dump_path.is_empty()) {
+		dump_memory_tags(memory_tags_dump_path);
+	}
+#endif
+
 	if (fixed_fps != -1) {
 		return exit;
 	}
@@ -3754,6 +3799,12 @@ void Main::cleanup(bool p_force) {
 	message_queue->flush();
 	memdelete(message_queue);
 
+#ifdef SMALL_ALLOCATOR_ENABLED
+	if (OS::get_singleton()->is_stdout_verbose()) {
+		SmallAllocator::print_stats();
+	}
+#endif
+
 	unregister_core_driver_types();
 	unregister_core_extensions();
 	uninitialize_modules(MODULE_INITIALIZATION_LEVEL_CORE);
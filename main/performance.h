@@ -100,6 +100,7 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		MEMORY_FRAME_ARENA,
 		MONITOR_MAX
 	};
 
@@ -422,6 +422,14 @@ void GDScript::set_source_code(const String &p_code) {
 #endif
 }
 
+void GDScript::set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens) {
+	binary_tokens = p_binary_tokens;
+}
+
+const Vector<uint8_t> &GDScript::get_binary_tokens_source() const {
+	return binary_tokens;
+}
+
 #ifdef TOOLS_ENABLED
 void GDScript::_update_exports_values(HashMap<StringName, Variant> &values, List<PropertyInfo> &propnames) {
 	for (const KeyValue<StringName, Variant> &E : member_default_values_cache) {
@@ -675,6 +683,8 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 	reloading = true;
 
+	Memory::TagScope tag_scope(Memory::TAG_SCRIPT);
+
 	bool has_instances;
 	{
 		MutexLock lock(GDScriptLanguage::singleton->mutex);
@@ -724,7 +734,17 @@ Error GDScript::reload(bool p_keep_state) {
 
 	valid = false;
 	GDScriptParser parser;
-	Error err = parser.parse(source, path, false);
+	Error err;
+	if (!binary_tokens.is_empty()) {
+		err = parser.parse_binary(binary_tokens, path);
+	} else {
+		err = parser.parse(source, path, false);
+	}
+	if (err && parser.get_errors().is_empty()) {
+		// The binary tokens couldn't be decoded, so there's no parse error to report.
+		reloading = false;
+		ERR_FAIL_V_MSG(err, "Script '" + path + "' contains invalid binary tokens, so it was not loaded.");
+	}
 	if (err) {
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
@@ -735,6 +755,9 @@ Error GDScript::reload(bool p_keep_state) {
 		return ERR_PARSE_ERROR;
 	}
 
+	// Start parsing the scripts this one depends on in parallel, the analyzer finds those done in the cache.
+	GDScriptCache::parse_dependencies(&parser);
+
 	GDScriptAnalyzer analyzer(&parser);
 	err = analyzer.analyze();
 
@@ -2665,7 +2688,9 @@ Ref<GDScript> GDScriptLanguage::get_script_by_fully_qualified_name(const String
 
 Ref<Resource> ResourceFormatLoaderGDScript::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
 	Error err;
-	Ref<GDScript> scr = GDScriptCache::get_full_script(p_path, err, "", p_cache_mode == CACHE_MODE_IGNORE);
+	// Exported scripts are remapped to their binary tokens, but are still cached under their original path.
+	String path = p_original_path.is_empty() ? p_path : p_original_path;
+	Ref<GDScript> scr = GDScriptCache::get_full_script(path, err, "", p_cache_mode == CACHE_MODE_IGNORE);
 
 	if (err && scr.is_valid()) {
 		// If !scr.is_valid(), the error was likely from scr->load_source_code(), which already generates an error.
@@ -2682,6 +2707,7 @@ Ref<Resource> ResourceFormatLoaderGDScript::load(const String &p_path, const Str
 
 void ResourceFormatLoaderGDScript::get_recognized_extensions(List<String> *p_extensions) const {
 	p_extensions->push_back("gd");
+	p_extensions->push_back("gdc");
 }
 
 bool ResourceFormatLoaderGDScript::handles_type(const String &p_type) const {
@@ -2690,7 +2716,7 @@ bool ResourceFormatLoaderGDScript::handles_type(const String &p_type) const {
 
 String ResourceFormatLoaderGDScript::get_resource_type(const String &p_path) const {
 	String el = p_path.get_extension().to_lower();
-	if (el == "gd") {
+	if (el == "gd" || el == "gdc") {
 		return "GDScript";
 	}
 	return "";
@@ -2700,14 +2726,21 @@ void ResourceFormatLoaderGDScript::get_dependencies(const String &p_path, List<S
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
 
-	String source = file->get_as_utf8_string();
-	if (source.is_empty()) {
-		return;
-	}
-
 	GDScriptParser parser;
-	if (OK != parser.parse(source, p_path, false)) {
-		return;
+	if (p_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> buffer = file->get_buffer(file->get_length());
+		if (buffer.is_empty() || OK != parser.parse_binary(buffer, p_path)) {
+			return;
+		}
+	} else {
+		String source = file->get_as_utf8_string();
+		if (source.is_empty()) {
+			return;
+		}
+
+		if (OK != parser.parse(source, p_path, false)) {
+			return;
+		}
 	}
 
 	for (const String &E : parser.get_dependencies()) {
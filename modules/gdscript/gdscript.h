@@ -140,6 +140,7 @@ class GDScript : public Script {
 	bool clearing = false;
 	//exported members
 	String source;
+	Vector<uint8_t> binary_tokens;
 	String path;
 	StringName local_name; // Inner class identifier or `class_name`.
 	StringName global_name; // `class_name`.
@@ -243,6 +244,8 @@ public:
 	virtual bool has_source_code() const override;
 	virtual String get_source_code() const override;
 	virtual void set_source_code(const String &p_code) override;
+	void set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens);
+	const Vector<uint8_t> &get_binary_tokens_source() const;
 	virtual void update_exports() override;
 
 #ifdef TOOLS_ENABLED
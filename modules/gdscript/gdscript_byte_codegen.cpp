@@ -136,6 +136,7 @@ uint32_t GDScriptByteCodeGenerator::add_temporary(const GDScriptDataType &p_type
 void GDScriptByteCodeGenerator::pop_temporary() {
 	ERR_FAIL_COND(used_temporaries.is_empty());
 	int slot_idx = used_temporaries.back()->get();
+	_peephole_forward_temporary(slot_idx);
 	const StackSlot &slot = temporaries[slot_idx];
 	if (slot.type == Variant::NIL) {
 		// Avoid keeping in the stack long-lived references to objects,
@@ -152,6 +153,7 @@ void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
 		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
 		function->default_arguments.push_back(opcodes.size());
+		_peephole_barrier();
 	}
 }
 
@@ -198,11 +200,8 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 
 	if (constant_map.size()) {
 		function->_constant_count = constant_map.size();
-		function->constants.resize(constant_map.size());
+		function->constants = constant_values;
 		function->_constants_ptr = function->constants.ptrw();
-		for (const KeyValue<Variant, int> &K : constant_map) {
-			function->constants.write[K.value] = K.key;
-		}
 	} else {
 		function->_constants_ptr = nullptr;
 		function->_constant_count = 0;
@@ -395,6 +394,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_lambdas_count = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+		function->_inline_cache_count = inline_cache_count;
+	} else {
+		function->_inline_caches_ptr = nullptr;
+		function->_inline_cache_count = 0;
+	}
+
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
@@ -549,11 +556,239 @@ void GDScriptByteCodeGenerator::write_type_adjust(const Address &p_target, Varia
 		case Variant::VARIANT_MAX:
 			return;
 	}
+	_peephole_record(p_target);
 	append(p_target);
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::_get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_type) {
+#define TYPED_OPERATOR_CASE(m_op, m_name)                                                                         \
+	case Variant::OP_##m_op:                                                                                      \
+		return p_type == Variant::INT ? GDScriptFunction::OPCODE_##m_name##_INT : GDScriptFunction::OPCODE_##m_name##_FLOAT;
+
+	if (p_type != Variant::INT && p_type != Variant::FLOAT) {
+		return GDScriptFunction::OPCODE_END;
+	}
+
+	switch (p_operator) {
+		TYPED_OPERATOR_CASE(ADD, ADD)
+		TYPED_OPERATOR_CASE(SUBTRACT, SUBTRACT)
+		TYPED_OPERATOR_CASE(MULTIPLY, MULTIPLY)
+		TYPED_OPERATOR_CASE(EQUAL, EQUAL)
+		TYPED_OPERATOR_CASE(NOT_EQUAL, NOT_EQUAL)
+		TYPED_OPERATOR_CASE(LESS, LESS)
+		TYPED_OPERATOR_CASE(LESS_EQUAL, LESS_EQUAL)
+		TYPED_OPERATOR_CASE(GREATER, GREATER)
+		TYPED_OPERATOR_CASE(GREATER_EQUAL, GREATER_EQUAL)
+		case Variant::OP_DIVIDE:
+			// Integer division goes through the evaluator, which checks for division by zero.
+			return p_type == Variant::FLOAT ? GDScriptFunction::OPCODE_DIVIDE_FLOAT : GDScriptFunction::OPCODE_END;
+		default:
+			return GDScriptFunction::OPCODE_END;
+	}
+
+#undef TYPED_OPERATOR_CASE
+}
+
+bool GDScriptByteCodeGenerator::_is_int_constant_one(const Address &p_address) const {
+	if (p_address.mode != Address::CONSTANT) {
+		return false;
+	}
+	const int *pos = constant_map.getptr(Variant(1));
+	return pos && uint32_t(*pos) == p_address.address;
+}
+
+void GDScriptByteCodeGenerator::_peephole_record_operator(const Address &p_left_operand, const Address &p_right_operand, const Address &p_target, Variant::Operator p_operator, Variant::ValidatedOperatorEvaluator p_operator_func, Variant::Type p_result_type) {
+	_peephole_record(p_left_operand, p_right_operand, p_target);
+	PeepholeInstruction *instruction = _peephole_get(0);
+	instruction->variant_operator = p_operator;
+	instruction->operator_func = p_operator_func;
+	instruction->result_type = p_result_type;
+}
+
+void GDScriptByteCodeGenerator::_peephole_truncate(int p_position) {
+	// Forget the temporaries referenced by the removed code, they're added again when the replacement is written.
+	for (int i = 0; i < temporaries.size(); i++) {
+		Vector<int> &indices = temporaries.write[i].bytecode_indices;
+		while (!indices.is_empty() && indices[indices.size() - 1] >= p_position) {
+			indices.resize(indices.size() - 1);
+		}
+	}
+	opcodes.resize(p_position);
+	while (peephole_count > 0 && _peephole_get(0)->position >= p_position) {
+		peephole_count--;
+	}
+}
+
+bool GDScriptByteCodeGenerator::_peephole_fuse_jump_if_not(const Address &p_condition) {
+	// Compare and branch in one instruction when the condition is the result of the last typed comparison.
+	const PeepholeInstruction *compare = _peephole_get(0);
+	if (p_condition.mode != Address::TEMPORARY || !compare || !compare->has_operands || !_is_same_address(compare->operands[2], p_condition)) {
+		return false;
+	}
+
+	GDScriptFunction::Opcode jump_opcode;
+	switch (compare->opcode) {
+#define FUSED_JUMP_CASE(m_name, m_type)                                      \
+	case GDScriptFunction::OPCODE_##m_name##_##m_type:                       \
+		jump_opcode = GDScriptFunction::OPCODE_JUMP_IF_NOT_##m_name##_##m_type; \
+		break;
+
+		FUSED_JUMP_CASE(EQUAL, INT)
+		FUSED_JUMP_CASE(NOT_EQUAL, INT)
+		FUSED_JUMP_CASE(LESS, INT)
+		FUSED_JUMP_CASE(LESS_EQUAL, INT)
+		FUSED_JUMP_CASE(GREATER, INT)
+		FUSED_JUMP_CASE(GREATER_EQUAL, INT)
+		FUSED_JUMP_CASE(EQUAL, FLOAT)
+		FUSED_JUMP_CASE(NOT_EQUAL, FLOAT)
+		FUSED_JUMP_CASE(LESS, FLOAT)
+		FUSED_JUMP_CASE(LESS_EQUAL, FLOAT)
+		FUSED_JUMP_CASE(GREATER, FLOAT)
+		FUSED_JUMP_CASE(GREATER_EQUAL, FLOAT)
+#undef FUSED_JUMP_CASE
+		default:
+			return false;
+	}
+
+	Address left_operand = compare->operands[0];
+	Address right_operand = compare->operands[1];
+	_peephole_truncate(compare->position);
+
+	append_opcode(jump_opcode);
+	append(left_operand);
+	append(right_operand);
+	return true;
+}
+
+bool GDScriptByteCodeGenerator::_peephole_fuse_set_member(const Address &p_value, const StringName &p_name) {
+	// Turn `GET_MEMBER, [TYPE_ADJUST], OPERATOR, SET_MEMBER` from compound assignments into one instruction.
+	const PeepholeInstruction *operation = _peephole_get(0);
+	if (p_value.mode != Address::TEMPORARY || !operation || !operation->operator_func || !_is_same_address(operation->operands[2], p_value)) {
+		return false;
+	}
+
+	int back = 1;
+	const PeepholeInstruction *get = _peephole_get(back);
+	if (get && get->has_operands && get->opcode >= GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL && get->opcode <= GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY) {
+		if (!_is_same_address(get->operands[0], p_value)) {
+			return false;
+		}
+		// The merged instruction sets the result type itself.
+		get = _peephole_get(++back);
+	}
+	if (!get || get->opcode != GDScriptFunction::OPCODE_GET_MEMBER || get->name != p_name || get->operands[0].mode != Address::TEMPORARY || !_is_same_address(get->operands[0], operation->operands[0]) || _is_same_address(get->operands[0], operation->operands[1])) {
+		return false;
+	}
+
+	Address value = operation->operands[1];
+#ifdef DEBUG_ENABLED
+	Variant::Operator variant_operator = operation->variant_operator;
+#endif
+	Variant::ValidatedOperatorEvaluator operator_func = operation->operator_func;
+	Variant::Type result_type = operation->result_type;
+	_peephole_truncate(get->position);
+
+	append_opcode(GDScriptFunction::OPCODE_SET_MEMBER_OPERATOR_VALIDATED);
+	append(value);
+	append(p_value);
+	append(p_name);
+	append(operator_func);
+	append(result_type);
+#ifdef DEBUG_ENABLED
+	add_debug_name(operator_names, get_operation_pos(operator_func), Variant::get_operator_name(variant_operator));
+#endif
+	return true;
+}
+
+void GDScriptByteCodeGenerator::_peephole_forward_temporary(int p_slot) {
+	// When an operator result is only copied somewhere else before the temporary is released,
+	// write the result to the final destination directly and drop the copy.
+	const PeepholeInstruction *assign = _peephole_get(0);
+	PeepholeInstruction *operation = _peephole_get(1);
+	if (!assign || !operation || assign->opcode != GDScriptFunction::OPCODE_ASSIGN || operation->opcode != GDScriptFunction::OPCODE_OPERATOR || !assign->has_operands || !operation->has_operands) {
+		return;
+	}
+
+	const Address &source = assign->operands[1];
+	Address target = assign->operands[0];
+	if (source.mode != Address::TEMPORARY || source.address != uint32_t(p_slot) || !_is_same_address(operation->operands[2], source)) {
+		return;
+	}
+	// The generic operator resets its target before evaluating, so it can't alias an operand.
+	switch (target.mode) {
+		case Address::MEMBER:
+		case Address::LOCAL_VARIABLE:
+		case Address::FUNCTION_PARAMETER:
+			break;
+		default:
+			return;
+	}
+	if (_is_same_address(target, operation->operands[0]) || _is_same_address(target, operation->operands[1])) {
+		return;
+	}
+
+	int target_index = operation->position + 3;
+	_peephole_truncate(assign->position);
+
+	Vector<int> &indices = temporaries.write[p_slot].bytecode_indices;
+	ERR_FAIL_COND(indices.is_empty() || indices[indices.size() - 1] != target_index);
+	indices.resize(indices.size() - 1);
+	opcodes.write[target_index] = address_of(target);
+	operation->operands[2] = target;
+}
+
+bool GDScriptByteCodeGenerator::_get_constant_value(const Address &p_address, Variant &r_value) const {
+	if (p_address.mode != Address::CONSTANT || p_address.address >= uint32_t(constant_values.size())) {
+		return false;
+	}
+	r_value = constant_values[p_address.address];
+	return true;
+}
+
+bool GDScriptByteCodeGenerator::_fold_constant_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	Variant left;
+	Variant right;
+	if (!_get_constant_value(p_left_operand, left) || (p_right_operand.mode != Address::NIL && !_get_constant_value(p_right_operand, right))) {
+		return false;
+	}
+
+	Variant result;
+	bool valid = false;
+	Variant::evaluate(p_operator, left, right, result, valid);
+	// Errors are left for the runtime to report, and containers or objects must not be shared through a constant.
+	if (!valid || result.get_type() == Variant::NIL || result.get_type() >= Variant::OBJECT) {
+		return false;
+	}
+	if (p_target.mode == Address::TEMPORARY && temporaries[p_target.address].type != Variant::NIL && temporaries[p_target.address].type != result.get_type()) {
+		return false;
+	}
+
+	GDScriptDataType result_type;
+	result_type.has_type = true;
+	result_type.kind = GDScriptDataType::BUILTIN;
+	result_type.builtin_type = result.get_type();
+	write_assign(p_target, Address(Address::CONSTANT, get_constant_pos(result), result_type));
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand) {
+	if (_fold_constant_operator(p_target, p_operator, p_left_operand, Address())) {
+		return;
+	}
+
 	if (HAS_BUILTIN_TYPE(p_left_operand)) {
+		if (p_operator == Variant::OP_NEGATE && p_target.mode == Address::TEMPORARY && (p_left_operand.type.builtin_type == Variant::INT || p_left_operand.type.builtin_type == Variant::FLOAT)) {
+			if (temporaries[p_target.address].type != p_left_operand.type.builtin_type) {
+				write_type_adjust(p_target, p_left_operand.type.builtin_type);
+			}
+
+			// Negate the payload directly, no need to go through the operator evaluator.
+			append_opcode(p_left_operand.type.builtin_type == Variant::INT ? GDScriptFunction::OPCODE_NEGATE_INT : GDScriptFunction::OPCODE_NEGATE_FLOAT);
+			append(p_left_operand);
+			append(p_target);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, Variant::NIL);
 
@@ -570,6 +805,7 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 
 	// No specific types, perform variant evaluation.
 	append_opcode(GDScriptFunction::OPCODE_OPERATOR);
+	_peephole_record(p_left_operand, Address(), p_target);
 	append(p_left_operand);
 	append(Address());
 	append(p_target);
@@ -583,20 +819,55 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 }
 
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
+	if (_fold_constant_operator(p_target, p_operator, p_left_operand, p_right_operand)) {
+		return;
+	}
+
 	// Avoid validated evaluator for modulo and division when operands are int, since there's no check for division by zero.
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && ((p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) || p_left_operand.type.builtin_type != Variant::INT || p_right_operand.type.builtin_type != Variant::INT)) {
+		// Gather specific operator.
+		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+
 		if (p_target.mode == Address::TEMPORARY) {
-			Variant::Type result_type = Variant::get_operator_return_type(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 			Variant::Type temp_type = temporaries[p_target.address].type;
 			if (result_type != temp_type) {
 				write_type_adjust(p_target, result_type);
 			}
-		}
 
-		// Gather specific operator.
-		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+			// Both operands are int or both are float, so the result can be computed on the payloads.
+			if (p_left_operand.type.builtin_type == p_right_operand.type.builtin_type) {
+				Variant::Type operand_type = p_left_operand.type.builtin_type;
+				if (operand_type == Variant::INT && (p_operator == Variant::OP_ADD || p_operator == Variant::OP_SUBTRACT)) {
+					const Address *other = nullptr;
+					if (_is_int_constant_one(p_right_operand)) {
+						other = &p_left_operand;
+					} else if (p_operator == Variant::OP_ADD && _is_int_constant_one(p_left_operand)) {
+						other = &p_right_operand;
+					}
+					if (other) {
+						append_opcode(p_operator == Variant::OP_ADD ? GDScriptFunction::OPCODE_INCREMENT_INT : GDScriptFunction::OPCODE_DECREMENT_INT);
+						_peephole_record_operator(p_left_operand, p_right_operand, p_target, p_operator, op_func, result_type);
+						append(*other);
+						append(p_target);
+						return;
+					}
+				}
+
+				GDScriptFunction::Opcode typed_opcode = _get_typed_operator_opcode(p_operator, operand_type);
+				if (typed_opcode != GDScriptFunction::OPCODE_END) {
+					append_opcode(typed_opcode);
+					_peephole_record_operator(p_left_operand, p_right_operand, p_target, p_operator, op_func, result_type);
+					append(p_left_operand);
+					append(p_right_operand);
+					append(p_target);
+					return;
+				}
+			}
+		}
 
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+		_peephole_record_operator(p_left_operand, p_right_operand, p_target, p_operator, op_func, result_type);
 		append(p_left_operand);
 		append(p_right_operand);
 		append(p_target);
@@ -609,6 +880,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 
 	// No specific types, perform variant evaluation.
 	append_opcode(GDScriptFunction::OPCODE_OPERATOR);
+	_peephole_record(p_left_operand, p_right_operand, p_target);
 	append(p_left_operand);
 	append(p_right_operand);
 	append(p_target);
@@ -689,6 +961,7 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 	logic_op_jump_pos2.pop_back();
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_FALSE);
 	append(p_target);
+	_peephole_barrier(); // The jump over the fail condition lands here.
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
@@ -719,6 +992,7 @@ void GDScriptByteCodeGenerator::write_end_or(const Address &p_target) {
 	logic_op_jump_pos2.pop_back();
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_TRUE);
 	append(p_target);
+	_peephole_barrier(); // The jump over the fail condition lands here.
 }
 
 void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
@@ -830,6 +1104,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -848,9 +1123,14 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
+	if (_peephole_fuse_set_member(p_value, p_name)) {
+		return;
+	}
+
 	append_opcode(GDScriptFunction::OPCODE_SET_MEMBER);
 	append(p_value);
 	append(p_name);
@@ -858,6 +1138,8 @@ void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const S
 
 void GDScriptByteCodeGenerator::write_get_member(const Address &p_target, const StringName &p_name) {
 	append_opcode(GDScriptFunction::OPCODE_GET_MEMBER);
+	_peephole_record(p_target);
+	_peephole_get(0)->name = p_name;
 	append(p_target);
 	append(p_name);
 }
@@ -941,6 +1223,7 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target.type.builtin_type);
 	} else {
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
+		_peephole_record(p_target, p_source);
 		append(p_target);
 		append(p_source);
 	}
@@ -963,6 +1246,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	_peephole_barrier();
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
@@ -1033,6 +1317,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1058,6 +1343,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1306,6 +1592,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1319,6 +1606,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1332,6 +1620,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1449,8 +1738,10 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!_peephole_fuse_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1611,12 +1902,14 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	// Next iteration.
 	int continue_addr = opcodes.size();
 	continue_addrs.push_back(continue_addr);
+	_peephole_barrier();
 	append_opcode(iterate_opcode);
 	append(counter);
 	append(container);
 	append(p_use_conversion ? temp : p_variable);
 	for_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
+	_peephole_barrier(); // The first iteration jumps here.
 
 	if (p_use_conversion) {
 		write_assign_with_conversion(p_variable, temp);
@@ -1653,12 +1946,15 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	_peephole_barrier();
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (!_peephole_fuse_jump_if_not(p_condition)) {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -104,6 +104,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 #endif
 
 	HashMap<Variant, int, VariantHasher, VariantComparator> constant_map;
+	Vector<Variant> constant_values; // Indexed by constant position, to look them up from addresses.
 	RBMap<StringName, int> name_map;
 #ifdef TOOLS_ENABLED
 	Vector<StringName> named_globals;
@@ -121,6 +122,25 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	RBMap<GDScriptUtilityFunctions::FunctionPtr, int> gds_utilities_map;
 	RBMap<MethodBind *, int> method_bind_map;
 	RBMap<GDScriptFunction *, int> lambdas_map;
+	int inline_cache_count = 0;
+
+	// Last instructions emitted since the previous jump target. The peephole
+	// optimizer merges these into superinstructions as the code is written,
+	// so no instruction that a jump can land on is ever rewritten.
+	struct PeepholeInstruction {
+		int position = 0;
+		GDScriptFunction::Opcode opcode = GDScriptFunction::OPCODE_END;
+		bool has_operands = false; // Only set for the instructions the optimizer knows how to merge.
+		Address operands[3];
+		StringName name;
+		Variant::Operator variant_operator = Variant::OP_MAX;
+		Variant::ValidatedOperatorEvaluator operator_func = nullptr;
+		Variant::Type result_type = Variant::NIL;
+	};
+	static const int PEEPHOLE_WINDOW_SIZE = 4;
+	PeepholeInstruction peephole_window[PEEPHOLE_WINDOW_SIZE];
+	int peephole_head = 0;
+	int peephole_count = 0;
 
 #if DEBUG_ENABLED
 	// Keep method and property names for pointer and validated operations.
@@ -226,6 +246,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		}
 		int pos = constant_map.size();
 		constant_map[p_constant] = pos;
+		constant_values.push_back(p_constant);
 		return pos;
 	}
 
@@ -377,10 +398,12 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	void append_opcode(GDScriptFunction::Opcode p_code) {
+		_peephole_push(p_code);
 		opcodes.push_back(p_code);
 	}
 
 	void append_opcode_and_argcount(GDScriptFunction::Opcode p_code, int p_argument_count) {
+		_peephole_push(p_code);
 		opcodes.push_back(p_code);
 		opcodes.push_back(p_argument_count);
 		instr_args_max = MAX(instr_args_max, p_argument_count);
@@ -398,6 +421,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_name_map_pos(p_name));
 	}
 
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void append(const Variant::ValidatedOperatorEvaluator p_operation) {
 		opcodes.push_back(get_operation_pos(p_operation));
 	}
@@ -452,8 +479,58 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		_peephole_barrier();
+	}
+
+	void _peephole_push(GDScriptFunction::Opcode p_opcode) {
+		if (peephole_count < PEEPHOLE_WINDOW_SIZE) {
+			peephole_count++;
+		} else {
+			peephole_head = (peephole_head + 1) % PEEPHOLE_WINDOW_SIZE;
+		}
+		PeepholeInstruction &instruction = peephole_window[(peephole_head + peephole_count - 1) % PEEPHOLE_WINDOW_SIZE];
+		instruction.position = opcodes.size();
+		instruction.opcode = p_opcode;
+		instruction.has_operands = false;
+		instruction.operator_func = nullptr;
+	}
+
+	// Returns the instruction emitted `p_back` instructions ago, or null if a jump target is in between.
+	PeepholeInstruction *_peephole_get(int p_back) {
+		if (p_back >= peephole_count) {
+			return nullptr;
+		}
+		return &peephole_window[(peephole_head + peephole_count - 1 - p_back) % PEEPHOLE_WINDOW_SIZE];
+	}
+
+	// Must be called whenever the current position becomes a jump target.
+	void _peephole_barrier() {
+		peephole_count = 0;
+	}
+
+	void _peephole_record(const Address &p_first, const Address &p_second = Address(), const Address &p_third = Address()) {
+		PeepholeInstruction *instruction = _peephole_get(0);
+		instruction->operands[0] = p_first;
+		instruction->operands[1] = p_second;
+		instruction->operands[2] = p_third;
+		instruction->has_operands = true;
 	}
 
+	static bool _is_same_address(const Address &p_a, const Address &p_b) {
+		return p_a.mode == p_b.mode && p_a.address == p_b.address;
+	}
+
+	void _peephole_record_operator(const Address &p_left_operand, const Address &p_right_operand, const Address &p_target, Variant::Operator p_operator, Variant::ValidatedOperatorEvaluator p_operator_func, Variant::Type p_result_type);
+	void _peephole_truncate(int p_position);
+	bool _peephole_fuse_jump_if_not(const Address &p_condition);
+	bool _peephole_fuse_set_member(const Address &p_value, const StringName &p_name);
+	void _peephole_forward_temporary(int p_slot);
+	bool _get_constant_value(const Address &p_address, Variant &r_value) const;
+	bool _fold_constant_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand);
+
+	static GDScriptFunction::Opcode _get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_type);
+	bool _is_int_constant_one(const Address &p_address) const;
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
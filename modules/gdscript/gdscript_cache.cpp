@@ -36,6 +36,7 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/io/resource_loader.h"
 #include "core/templates/vector.h"
 #include "scene/resources/packed_scene.h"
 
@@ -69,7 +70,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 		switch (status) {
 			case EMPTY:
 				status = PARSED;
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
+				result = GDScriptCache::_parse_script(parser, path);
 				break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
@@ -151,6 +152,12 @@ void GDScriptCache::move_script(const String &p_from, const String &p_to) {
 	}
 	singleton->parser_map.erase(p_from);
 
+	singleton->prefetching_paths.erase(p_from);
+	if (singleton->prefetched_parsers.has(p_from) && !p_from.is_empty()) {
+		singleton->prefetched_parsers[p_to] = singleton->prefetched_parsers[p_from];
+	}
+	singleton->prefetched_parsers.erase(p_from);
+
 	if (singleton->shallow_gdscript_cache.has(p_from) && !p_from.is_empty()) {
 		singleton->shallow_gdscript_cache[p_to] = singleton->shallow_gdscript_cache[p_from];
 	}
@@ -187,6 +194,8 @@ void GDScriptCache::remove_script(const String &p_path) {
 		singleton->parser_map.erase(p_path);
 	}
 
+	singleton->prefetching_paths.erase(p_path);
+	singleton->prefetched_parsers.erase(p_path);
 	singleton->dependencies.erase(p_path);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
@@ -194,6 +203,9 @@ void GDScriptCache::remove_script(const String &p_path) {
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
+	if (!singleton->parse_batches.is_empty()) {
+		singleton->_collect_parse_batches();
+	}
 	Ref<GDScriptParserRef> ref;
 	if (!p_owner.is_empty()) {
 		singleton->dependencies[p_owner].insert(p_path);
@@ -205,7 +217,8 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 			return ref;
 		}
 	} else {
-		if (!FileAccess::exists(p_path)) {
+		String remapped_path = ResourceLoader::path_remap(p_path);
+		if (!FileAccess::exists(remapped_path)) {
 			r_error = ERR_FILE_NOT_FOUND;
 			return ref;
 		}
@@ -220,6 +233,91 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
+void GDScriptCache::parse_dependencies(const GDScriptParser *p_parser) {
+	MutexLock lock(singleton->mutex);
+	if (singleton->cleared) {
+		return;
+	}
+	singleton->_collect_parse_batches();
+
+	// Only direct dependencies that aren't loaded or parsed yet. Their own dependencies are looked
+	// ahead when they're loaded in turn. Analysis and compilation stay on the loading thread.
+	ParseBatch *batch = nullptr;
+	for (const String &path : p_parser->get_dependencies(true)) {
+		if (path.get_extension().to_lower() != "gd" || singleton->parser_map.has(path) || singleton->prefetching_paths.has(path) || singleton->full_gdscript_cache.has(path) || singleton->shallow_gdscript_cache.has(path)) {
+			continue;
+		}
+		if (!FileAccess::exists(ResourceLoader::path_remap(path))) {
+			continue;
+		}
+
+		if (batch == nullptr) {
+			batch = memnew(ParseBatch);
+		}
+		// Parsers are created here, as their constructor initializes shared data.
+		ParseTask task;
+		task.path = path;
+		task.parser = memnew(GDScriptParser);
+		batch->tasks.push_back(task);
+		singleton->prefetching_paths.insert(path);
+	}
+
+	if (batch == nullptr) {
+		return;
+	}
+
+	// Not waited for here. Whatever the loading thread needs before it's done is parsed on demand as usual.
+	batch->group_task = WorkerThreadPool::get_singleton()->add_template_group_task(singleton, &GDScriptCache::_parse_task, batch->tasks.ptr(), batch->tasks.size(), -1, true, SNAME("GDScriptParseDependencies"));
+	singleton->parse_batches.push_back(batch);
+}
+
+void GDScriptCache::_collect_parse_batches() {
+	for (uint32_t i = 0; i < parse_batches.size(); i++) {
+		ParseBatch *batch = parse_batches[i];
+		if (!WorkerThreadPool::get_singleton()->is_group_task_completed(batch->group_task)) {
+			continue;
+		}
+		// Already done, this doesn't block.
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_task);
+
+		for (ParseTask &task : batch->tasks) {
+			if (!prefetching_paths.has(task.path) || parser_map.has(task.path)) {
+				// Removed, or parsed on demand in the meantime.
+				memdelete(task.parser);
+			} else {
+				Ref<GDScriptParserRef> ref;
+				ref.instantiate();
+				ref->parser = task.parser;
+				ref->path = task.path;
+				ref->status = GDScriptParserRef::PARSED;
+				ref->result = task.result;
+				parser_map[task.path] = ref.ptr();
+				prefetched_parsers[task.path] = ref;
+			}
+			prefetching_paths.erase(task.path);
+		}
+
+		memdelete(batch);
+		parse_batches.remove_at_unordered(i);
+		i--;
+	}
+}
+
+Error GDScriptCache::_parse_script(GDScriptParser *p_parser, const String &p_path) {
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		return p_parser->parse_binary(get_binary_tokens(remapped_path), p_path);
+	}
+	return p_parser->parse(get_source_code(p_path), p_path, false);
+}
+
+void GDScriptCache::_parse_task(uint32_t p_index, ParseTask *p_tasks) {
+	Memory::TagScope tag_scope(Memory::TAG_SCRIPT);
+
+	ParseTask &task = p_tasks[p_index];
+	task.result = _parse_script(task.parser, task.path);
+}
+
 String GDScriptCache::get_source_code(const String &p_path) {
 	Vector<uint8_t> source_file;
 	Error err;
@@ -239,6 +337,13 @@ String GDScriptCache::get_source_code(const String &p_path) {
 	return source;
 }
 
+Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
+	Error err;
+	Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(p_path, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, buffer, "Failed to open binary GDScript file '" + p_path + "'.");
+	return buffer;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 	if (!p_owner.is_empty()) {
@@ -254,7 +359,16 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 	Ref<GDScript> script;
 	script.instantiate();
 	script->set_path(p_path, true);
-	r_error = script->load_source_code(p_path);
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> buffer = get_binary_tokens(remapped_path);
+		if (buffer.is_empty()) {
+			r_error = ERR_FILE_CANT_READ;
+		}
+		script->set_binary_tokens_source(buffer);
+	} else {
+		r_error = script->load_source_code(p_path);
+	}
 
 	if (r_error) {
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
@@ -293,9 +407,19 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 	}
 
 	if (p_update_from_disk) {
-		r_error = script->load_source_code(p_path);
-		if (r_error) {
-			return script;
+		String remapped_path = ResourceLoader::path_remap(p_path);
+		if (remapped_path.get_extension().to_lower() == "gdc") {
+			Vector<uint8_t> buffer = get_binary_tokens(remapped_path);
+			if (buffer.is_empty()) {
+				r_error = ERR_FILE_CANT_READ;
+				return script;
+			}
+			script->set_binary_tokens_source(buffer);
+		} else {
+			r_error = script->load_source_code(p_path);
+			if (r_error) {
+				return script;
+			}
 		}
 	}
 
@@ -306,6 +430,7 @@ Ref<GDScript> GDScriptCache::get_full_script(const String &p_path, Error &r_erro
 
 	singleton->full_gdscript_cache[p_path] = script;
 	singleton->shallow_gdscript_cache.erase(p_path);
+	singleton->prefetched_parsers.erase(p_path);
 
 	return script;
 }
@@ -416,6 +541,22 @@ void GDScriptCache::clear() {
 		return;
 	}
 
+	// Wait for the dependencies still being parsed without holding the lock.
+	LocalVector<ParseBatch *> batches;
+	{
+		MutexLock lock(singleton->mutex);
+		batches = singleton->parse_batches;
+		singleton->parse_batches.clear();
+		singleton->prefetching_paths.clear();
+	}
+	for (ParseBatch *batch : batches) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(batch->group_task);
+		for (ParseTask &task : batch->tasks) {
+			memdelete(task.parser);
+		}
+		memdelete(batch);
+	}
+
 	MutexLock lock(singleton->mutex);
 
 	if (singleton->cleared) {
@@ -437,6 +578,7 @@ void GDScriptCache::clear() {
 	singleton->packed_scene_cache.clear();
 
 	parser_map_refs.clear();
+	singleton->prefetched_parsers.clear();
 	singleton->parser_map.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
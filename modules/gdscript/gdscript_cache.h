@@ -34,6 +34,7 @@
 #include "gdscript.h"
 
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
@@ -94,11 +95,34 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	struct ParseTask {
+		String path;
+		GDScriptParser *parser = nullptr;
+		Error result = OK;
+	};
+
+	struct ParseBatch {
+		LocalVector<ParseTask> tasks;
+		WorkerThreadPool::GroupID group_task = -1;
+	};
+
+	// Dependencies parsed ahead of time. Batches are only waited for once done, so the cache is never
+	// locked while waiting. Their parsers are then kept until the script is loaded or removed.
+	LocalVector<ParseBatch *> parse_batches;
+	HashSet<String> prefetching_paths;
+	HashMap<String, Ref<GDScriptParserRef>> prefetched_parsers;
+
+	static Error _parse_script(GDScriptParser *p_parser, const String &p_path);
+	void _parse_task(uint32_t p_index, ParseTask *p_tasks);
+	void _collect_parse_batches();
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
+	static void parse_dependencies(const GDScriptParser *p_parser);
 	static String get_source_code(const String &p_path);
+	static Vector<uint8_t> get_binary_tokens(const String &p_path);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String(), bool p_update_from_disk = false);
 	static Ref<GDScript> get_cached_script(const String &p_path);
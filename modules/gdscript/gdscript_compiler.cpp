@@ -2981,6 +2981,9 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	// Create scripts for subclasses beforehand so they can be referenced
 	make_scripts(p_script, root, p_keep_state);
 
+	// Member layouts and functions are about to change, drop what call sites cached about them.
+	GDScriptFunction::invalidate_inline_caches();
+
 	main_script->_owner = nullptr;
 	Error err = _populate_class_members(main_script, parser->get_tree(), p_keep_state);
 
@@ -2993,6 +2996,8 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 		return err;
 	}
 
+	GDScriptFunction::invalidate_inline_caches();
+
 	if (has_static_data && !root->annotated_static_unload) {
 		GDScriptCache::add_static_script(p_script);
 	}
@@ -141,6 +141,55 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_TYPED_OPERATOR(m_name, m_type, m_operator) \
+	case OPCODE_##m_name##_##m_type: {                         \
+		text += "operator (";                                  \
+		text += #m_type;                                       \
+		text += ") ";                                          \
+		text += DADDR(3);                                      \
+		text += " = ";                                         \
+		text += DADDR(1);                                      \
+		text += " " m_operator " ";                            \
+		text += DADDR(2);                                      \
+		incr += 4;                                             \
+	} break
+
+#define DISASSEMBLE_TYPED_UNARY_OPERATOR(m_name, m_type, m_prefix, m_suffix) \
+	case OPCODE_##m_name##_##m_type: {                                       \
+		text += "operator (";                                                \
+		text += #m_type;                                                     \
+		text += ") ";                                                        \
+		text += DADDR(2);                                                    \
+		text += " = " m_prefix;                                              \
+		text += DADDR(1);                                                    \
+		text += m_suffix;                                                    \
+		incr += 3;                                                           \
+	} break
+
+			DISASSEMBLE_TYPED_OPERATOR(ADD, INT, "+");
+			DISASSEMBLE_TYPED_OPERATOR(SUBTRACT, INT, "-");
+			DISASSEMBLE_TYPED_OPERATOR(MULTIPLY, INT, "*");
+			DISASSEMBLE_TYPED_UNARY_OPERATOR(NEGATE, INT, "-", "");
+			DISASSEMBLE_TYPED_UNARY_OPERATOR(INCREMENT, INT, "", " + 1");
+			DISASSEMBLE_TYPED_UNARY_OPERATOR(DECREMENT, INT, "", " - 1");
+			DISASSEMBLE_TYPED_OPERATOR(EQUAL, INT, "==");
+			DISASSEMBLE_TYPED_OPERATOR(NOT_EQUAL, INT, "!=");
+			DISASSEMBLE_TYPED_OPERATOR(LESS, INT, "<");
+			DISASSEMBLE_TYPED_OPERATOR(LESS_EQUAL, INT, "<=");
+			DISASSEMBLE_TYPED_OPERATOR(GREATER, INT, ">");
+			DISASSEMBLE_TYPED_OPERATOR(GREATER_EQUAL, INT, ">=");
+			DISASSEMBLE_TYPED_OPERATOR(ADD, FLOAT, "+");
+			DISASSEMBLE_TYPED_OPERATOR(SUBTRACT, FLOAT, "-");
+			DISASSEMBLE_TYPED_OPERATOR(MULTIPLY, FLOAT, "*");
+			DISASSEMBLE_TYPED_OPERATOR(DIVIDE, FLOAT, "/");
+			DISASSEMBLE_TYPED_UNARY_OPERATOR(NEGATE, FLOAT, "-", "");
+			DISASSEMBLE_TYPED_OPERATOR(EQUAL, FLOAT, "==");
+			DISASSEMBLE_TYPED_OPERATOR(NOT_EQUAL, FLOAT, "!=");
+			DISASSEMBLE_TYPED_OPERATOR(LESS, FLOAT, "<");
+			DISASSEMBLE_TYPED_OPERATOR(LESS_EQUAL, FLOAT, "<=");
+			DISASSEMBLE_TYPED_OPERATOR(GREATER, FLOAT, ">");
+			DISASSEMBLE_TYPED_OPERATOR(GREATER_EQUAL, FLOAT, ">=");
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -267,7 +316,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -288,7 +337,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -320,6 +369,21 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 3;
 			} break;
+			case OPCODE_SET_MEMBER_OPERATOR_VALIDATED: {
+				text += "set_member operator ";
+				text += "[\"";
+				text += _global_names_ptr[_code_ptr[ip + 3]];
+				text += "\"] = ";
+				text += DADDR(2);
+				text += " = [\"";
+				text += _global_names_ptr[_code_ptr[ip + 3]];
+				text += "\"] ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(1);
+
+				incr += 6;
+			} break;
 			case OPCODE_SET_STATIC_VARIABLE: {
 				Ref<GDScript> gdscript = get_constant(_code_ptr[ip + 2] & ADDR_MASK);
 
@@ -590,7 +654,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -934,6 +998,32 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+
+#define DISASSEMBLE_JUMP_IF_NOT_COMPARE(m_name, m_type, m_operator) \
+	case OPCODE_JUMP_IF_NOT_##m_name##_##m_type: {                  \
+		text += "jump-if-not (";                                    \
+		text += #m_type;                                            \
+		text += ") ";                                               \
+		text += DADDR(1);                                           \
+		text += " " m_operator " ";                                 \
+		text += DADDR(2);                                           \
+		text += " to ";                                             \
+		text += itos(_code_ptr[ip + 3]);                            \
+		incr = 4;                                                   \
+	} break
+
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(EQUAL, INT, "==");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(NOT_EQUAL, INT, "!=");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS, INT, "<");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS_EQUAL, INT, "<=");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER, INT, ">");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL, INT, ">=");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(EQUAL, FLOAT, "==");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(NOT_EQUAL, FLOAT, "!=");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS, FLOAT, "<");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(LESS_EQUAL, FLOAT, "<=");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER, FLOAT, ">");
+			DISASSEMBLE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL, FLOAT, ">=");
 			case OPCODE_JUMP_TO_DEF_ARGUMENT: {
 				text += "jump-to-default-argument ";
 
@@ -35,6 +35,7 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
@@ -196,6 +197,30 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		// Operators on int and float operands, working on the Variant payloads directly.
+		OPCODE_ADD_INT,
+		OPCODE_SUBTRACT_INT,
+		OPCODE_MULTIPLY_INT,
+		OPCODE_NEGATE_INT,
+		OPCODE_INCREMENT_INT,
+		OPCODE_DECREMENT_INT,
+		OPCODE_EQUAL_INT,
+		OPCODE_NOT_EQUAL_INT,
+		OPCODE_LESS_INT,
+		OPCODE_LESS_EQUAL_INT,
+		OPCODE_GREATER_INT,
+		OPCODE_GREATER_EQUAL_INT,
+		OPCODE_ADD_FLOAT,
+		OPCODE_SUBTRACT_FLOAT,
+		OPCODE_MULTIPLY_FLOAT,
+		OPCODE_DIVIDE_FLOAT,
+		OPCODE_NEGATE_FLOAT,
+		OPCODE_EQUAL_FLOAT,
+		OPCODE_NOT_EQUAL_FLOAT,
+		OPCODE_LESS_FLOAT,
+		OPCODE_LESS_EQUAL_FLOAT,
+		OPCODE_GREATER_FLOAT,
+		OPCODE_GREATER_EQUAL_FLOAT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_NATIVE,
@@ -212,6 +237,7 @@ public:
 		OPCODE_GET_NAMED_VALIDATED,
 		OPCODE_SET_MEMBER,
 		OPCODE_GET_MEMBER,
+		OPCODE_SET_MEMBER_OPERATOR_VALIDATED,
 		OPCODE_SET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_GET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_ASSIGN,
@@ -287,6 +313,18 @@ public:
 		OPCODE_JUMP,
 		OPCODE_JUMP_IF,
 		OPCODE_JUMP_IF_NOT,
+		OPCODE_JUMP_IF_NOT_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_LESS_INT,
+		OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_GREATER_INT,
+		OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,
+		OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_LESS_FLOAT,
+		OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,
+		OPCODE_JUMP_IF_NOT_GREATER_FLOAT,
+		OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
 		OPCODE_RETURN,
@@ -486,6 +524,68 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	// Per call site caches for untyped named access and calls (OPCODE_GET_NAMED, OPCODE_SET_NAMED
+	// and OPCODE_CALL*). Entries are keyed on the receiver's native class and GDScript and are only
+	// appended, under `inline_cache_mutex`, until the cache is full. They are dropped lazily when
+	// `inline_cache_epoch` changes, which happens whenever scripts are (re)compiled or freed.
+	// Dropping them reuses the entries, so readers copy what they need and then check the epoch
+	// of the cache again, discarding the copy if the entries were reused meanwhile.
+	struct InlineCache {
+		enum Kind {
+			KIND_SCRIPT_MEMBER,
+			KIND_NATIVE_PROPERTY,
+			KIND_SCRIPT_FUNCTION,
+			KIND_METHOD_BIND,
+		};
+
+		struct Entry {
+			Kind kind = KIND_METHOD_BIND;
+			const GDScript *script = nullptr;
+			StringName native_class;
+			int index = -1;
+			const GDScriptDataType *member_type = nullptr;
+			MethodBind *method = nullptr;
+			GDScriptFunction *function = nullptr;
+		};
+
+		// What readers copy from a matching entry.
+		struct Hit {
+			Kind kind = KIND_METHOD_BIND;
+			int index = -1;
+			const GDScriptDataType *member_type = nullptr;
+			MethodBind *method = nullptr;
+			GDScriptFunction *function = nullptr;
+		};
+
+		static constexpr int MAX_ENTRIES = 4;
+		static constexpr uint32_t MAX_FAILURES = 8;
+
+		SafeNumeric<uint32_t> epoch;
+		SafeNumeric<uint32_t> count;
+		SafeNumeric<uint32_t> failures;
+		Entry entries[MAX_ENTRIES];
+	};
+
+	InlineCache *_inline_caches_ptr = nullptr;
+	int _inline_cache_count = 0;
+
+	static SafeNumeric<uint32_t> inline_cache_epoch;
+	static Mutex inline_cache_mutex;
+
+	static GDScriptInstance *_inline_cache_get_receiver(Object *p_object, const GDScript *&r_script, bool &r_cacheable);
+	static bool _inline_cache_find(InlineCache *p_cache, Object *p_object, const GDScript *p_script, InlineCache::Hit &r_hit);
+	static bool _inline_cache_script_claims_name(const GDScript *p_script, const StringName &p_name, bool p_set);
+	static bool _inline_cache_should_update(InlineCache *p_cache);
+	static void _inline_cache_sync_epoch(InlineCache *p_cache);
+	static void _inline_cache_add_failure(InlineCache *p_cache);
+	static void _inline_cache_add(InlineCache *p_cache, const InlineCache::Entry &p_entry);
+	static bool _inline_cache_get(InlineCache *p_cache, const Variant *p_base, Variant &r_ret);
+	static bool _inline_cache_set(InlineCache *p_cache, Variant *p_base, const Variant &p_value);
+	static bool _inline_cache_call(InlineCache *p_cache, Variant *p_base, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	static void _inline_cache_update_get(InlineCache *p_cache, const Variant *p_base, const StringName &p_name);
+	static void _inline_cache_update_set(InlineCache *p_cache, const Variant *p_base, const StringName &p_name);
+	static void _inline_cache_update_call(InlineCache *p_cache, const Variant *p_base, const StringName &p_name);
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
@@ -546,6 +646,8 @@ public:
 	StringName get_global_name(int p_idx) const;
 
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
+
+	static void invalidate_inline_caches() { inline_cache_epoch.increment(); }
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
 #ifdef DEBUG_ENABLED
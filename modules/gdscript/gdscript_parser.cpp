@@ -31,6 +31,7 @@
 #include "gdscript_parser.h"
 
 #include "gdscript.h"
+#include "gdscript_tokenizer_buffer.h"
 
 #ifdef DEBUG_ENABLED
 #include "gdscript_warning.h"
@@ -227,7 +228,7 @@ void GDScriptParser::make_completion_context(CompletionType p_type, Node *p_node
 	context.current_class = current_class;
 	context.current_function = current_function;
 	context.current_suite = current_suite;
-	context.current_line = tokenizer.get_cursor_line();
+	context.current_line = tokenizer->get_cursor_line();
 	context.current_argument = p_argument;
 	context.node = p_node;
 	completion_context = context;
@@ -245,7 +246,7 @@ void GDScriptParser::make_completion_context(CompletionType p_type, Variant::Typ
 	context.current_class = current_class;
 	context.current_function = current_function;
 	context.current_suite = current_suite;
-	context.current_line = tokenizer.get_cursor_line();
+	context.current_line = tokenizer->get_cursor_line();
 	context.builtin_type = p_builtin_type;
 	completion_context = context;
 }
@@ -321,17 +322,49 @@ Error GDScriptParser::parse(const String &p_source_code, const String &p_script_
 		source = source.replace_first(String::chr(0xFFFF), String());
 	}
 
-	tokenizer.set_source_code(source);
-	tokenizer.set_cursor_position(cursor_line, cursor_column);
+	GDScriptTokenizerText *text_tokenizer = memnew(GDScriptTokenizerText);
+	text_tokenizer->set_source_code(source);
+	text_tokenizer->set_cursor_position(cursor_line, cursor_column);
+	tokenizer = text_tokenizer;
+
 	script_path = p_script_path;
-	current = tokenizer.scan();
+	Error err = parse_token_stream();
+
+	memdelete(text_tokenizer);
+	tokenizer = nullptr;
+
+	return err;
+}
+
+Error GDScriptParser::parse_binary(const Vector<uint8_t> &p_binary, const String &p_script_path) {
+	clear();
+
+	GDScriptTokenizerBuffer *buffer_tokenizer = memnew(GDScriptTokenizerBuffer);
+	Error err = buffer_tokenizer->set_code_buffer(p_binary);
+	if (err) {
+		memdelete(buffer_tokenizer);
+		return err;
+	}
+	tokenizer = buffer_tokenizer;
+
+	script_path = p_script_path;
+	err = parse_token_stream();
+
+	memdelete(buffer_tokenizer);
+	tokenizer = nullptr;
+
+	return err;
+}
+
+Error GDScriptParser::parse_token_stream() {
+	current = tokenizer->scan();
 	// Avoid error or newline as the first token.
 	// The latter can mess with the parser when opening files filled exclusively with comments and newlines.
 	while (current.type == GDScriptTokenizer::Token::ERROR || current.type == GDScriptTokenizer::Token::NEWLINE) {
 		if (current.type == GDScriptTokenizer::Token::ERROR) {
 			push_error(current.literal);
 		}
-		current = tokenizer.scan();
+		current = tokenizer->scan();
 	}
 
 #ifdef DEBUG_ENABLED
@@ -365,6 +398,54 @@ Error GDScriptParser::parse(const String &p_source_code, const String &p_script_
 	}
 }
 
+const List<String> GDScriptParser::get_dependencies(bool p_include_global_classes) const {
+	// Collected from the parsed nodes, since it's only needed when looking ahead for scripts to load.
+	// Global classes are matched by identifier, so they may include some which are shadowed by a local name.
+	HashSet<String> found;
+	List<String> dependencies;
+
+	for (const Node *node = list; node != nullptr; node = node->next) {
+		String path;
+		switch (node->type) {
+			case Node::CLASS:
+				path = static_cast<const ClassNode *>(node)->extends_path;
+				break;
+			case Node::PRELOAD: {
+				const ExpressionNode *preload_path = static_cast<const PreloadNode *>(node)->path;
+				if (preload_path != nullptr && preload_path->type == Node::LITERAL) {
+					const Variant &value = static_cast<const LiteralNode *>(preload_path)->value;
+					if (value.get_type() == Variant::STRING) {
+						path = value;
+					}
+				}
+			} break;
+			case Node::IDENTIFIER: {
+				const StringName &name = static_cast<const IdentifierNode *>(node)->name;
+				if (p_include_global_classes && ScriptServer::is_global_class(name)) {
+					path = ScriptServer::get_global_class_path(name);
+				}
+			} break;
+			default:
+				break;
+		}
+
+		if (path.is_empty()) {
+			continue;
+		}
+		if (path.is_relative_path()) {
+			path = script_path.get_base_dir().path_join(path);
+		}
+		path = path.simplify_path();
+
+		if (path != script_path && !found.has(path)) {
+			found.insert(path);
+			dependencies.push_back(path);
+		}
+	}
+
+	return dependencies;
+}
+
 GDScriptTokenizer::Token GDScriptParser::advance() {
 	lambda_ended = false; // Empty marker since we're past the end in any case.
 
@@ -372,16 +453,16 @@ GDScriptTokenizer::Token GDScriptParser::advance() {
 		ERR_FAIL_COND_V_MSG(current.type == GDScriptTokenizer::Token::TK_EOF, current, "GDScript parser bug: Trying to advance past the end of stream.");
 	}
 	if (for_completion && !completion_call_stack.is_empty()) {
-		if (completion_call.call == nullptr && tokenizer.is_past_cursor()) {
+		if (completion_call.call == nullptr && tokenizer->is_past_cursor()) {
 			completion_call = completion_call_stack.back()->get();
 			passed_cursor = true;
 		}
 	}
 	previous = current;
-	current = tokenizer.scan();
+	current = tokenizer->scan();
 	while (current.type == GDScriptTokenizer::Token::ERROR) {
 		push_error(current.literal);
-		current = tokenizer.scan();
+		current = tokenizer->scan();
 	}
 	for (Node *n : nodes_in_progress) {
 		update_extents(n);
@@ -448,11 +529,11 @@ void GDScriptParser::synchronize() {
 
 void GDScriptParser::push_multiline(bool p_state) {
 	multiline_stack.push_back(p_state);
-	tokenizer.set_multiline_mode(p_state);
+	tokenizer->set_multiline_mode(p_state);
 	if (p_state) {
 		// Consume potential whitespace tokens already waiting in line.
 		while (current.type == GDScriptTokenizer::Token::NEWLINE || current.type == GDScriptTokenizer::Token::INDENT || current.type == GDScriptTokenizer::Token::DEDENT) {
-			current = tokenizer.scan(); // Don't call advance() here, as we don't want to change the previous token.
+			current = tokenizer->scan(); // Don't call advance() here, as we don't want to change the previous token.
 		}
 	}
 }
@@ -460,7 +541,7 @@ void GDScriptParser::push_multiline(bool p_state) {
 void GDScriptParser::pop_multiline() {
 	ERR_FAIL_COND_MSG(multiline_stack.size() == 0, "Parser bug: trying to pop from multiline stack without available value.");
 	multiline_stack.pop_back();
-	tokenizer.set_multiline_mode(multiline_stack.size() > 0 ? multiline_stack.back()->get() : false);
+	tokenizer->set_multiline_mode(multiline_stack.size() > 0 ? multiline_stack.back()->get() : false);
 }
 
 bool GDScriptParser::is_statement_end_token() const {
@@ -579,7 +660,7 @@ void GDScriptParser::parse_program() {
 	complete_extents(head);
 
 #ifdef TOOLS_ENABLED
-	for (const KeyValue<int, GDScriptTokenizer::CommentData> &E : tokenizer.get_comments()) {
+	for (const KeyValue<int, GDScriptTokenizer::CommentData> &E : tokenizer->get_comments()) {
 		if (E.value.new_line && E.value.comment.begins_with("##")) {
 			class_doc_line = MIN(class_doc_line, E.key);
 		}
@@ -3178,7 +3259,7 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_lambda(ExpressionNode *p_p
 	// Reset the multiline stack since we don't want the multiline mode one in the lambda body.
 	push_multiline(false);
 	if (multiline_context) {
-		tokenizer.push_expression_indented_block();
+		tokenizer->push_expression_indented_block();
 	}
 
 	push_multiline(true); // For the parameters.
@@ -3225,9 +3306,9 @@ GDScriptParser::ExpressionNode *GDScriptParser::parse_lambda(ExpressionNode *p_p
 	if (multiline_context) {
 		// If we're in multiline mode, we want to skip the spurious DEDENT and NEWLINE tokens.
 		while (check(GDScriptTokenizer::Token::DEDENT) || check(GDScriptTokenizer::Token::INDENT) || check(GDScriptTokenizer::Token::NEWLINE)) {
-			current = tokenizer.scan(); // Not advance() since we don't want to change the previous token.
+			current = tokenizer->scan(); // Not advance() since we don't want to change the previous token.
 		}
-		tokenizer.pop_expression_indented_block();
+		tokenizer->pop_expression_indented_block();
 	}
 
 	current_function = previous_function;
@@ -3443,20 +3524,20 @@ static String _process_doc_line(const String &p_line, const String &p_text, cons
 }
 
 bool GDScriptParser::has_comment(int p_line, bool p_must_be_doc) {
-	bool has_comment = tokenizer.get_comments().has(p_line);
+	bool has_comment = tokenizer->get_comments().has(p_line);
 	// If there are no comments or if we don't care whether the comment
 	// is a docstring, we have our result.
 	if (!p_must_be_doc || !has_comment) {
 		return has_comment;
 	}
 
-	return tokenizer.get_comments()[p_line].comment.begins_with("##");
+	return tokenizer->get_comments()[p_line].comment.begins_with("##");
 }
 
 GDScriptParser::MemberDocData GDScriptParser::parse_doc_comment(int p_line, bool p_single_line) {
 	MemberDocData result;
 
-	const HashMap<int, GDScriptTokenizer::CommentData> &comments = tokenizer.get_comments();
+	const HashMap<int, GDScriptTokenizer::CommentData> &comments = tokenizer->get_comments();
 	ERR_FAIL_COND_V(!comments.has(p_line), result);
 
 	if (p_single_line) {
@@ -3516,7 +3597,7 @@ GDScriptParser::MemberDocData GDScriptParser::parse_doc_comment(int p_line, bool
 GDScriptParser::ClassDocData GDScriptParser::parse_class_doc_comment(int p_line, bool p_inner_class, bool p_single_line) {
 	ClassDocData result;
 
-	const HashMap<int, GDScriptTokenizer::CommentData> &comments = tokenizer.get_comments();
+	const HashMap<int, GDScriptTokenizer::CommentData> &comments = tokenizer->get_comments();
 	ERR_FAIL_COND_V(!comments.has(p_line), result);
 
 	if (p_single_line) {
@@ -0,0 +1,434 @@
+/**************************************************************************/
+/*  gdscript_tokenizer_buffer.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_tokenizer_buffer.h"
+
+#include "core/io/compression.h"
+#include "core/io/marshalls.h"
+#include "core/templates/hash_set.h"
+
+int GDScriptTokenizerBuffer::_token_to_binary(const Token &p_token, Vector<uint8_t> &r_buffer, int p_start, HashMap<StringName, uint32_t> &r_identifiers_map, HashMap<Variant, uint32_t, VariantHasher, VariantComparator> &r_constants_map) {
+	int pos = p_start;
+
+	uint32_t token_type = p_token.type & TOKEN_MASK;
+
+	switch (p_token.type) {
+		case GDScriptTokenizer::Token::ANNOTATION:
+		case GDScriptTokenizer::Token::IDENTIFIER: {
+			// Add identifier to map.
+			uint32_t identifier_pos;
+			StringName id = p_token.literal;
+			if (r_identifiers_map.has(id)) {
+				identifier_pos = r_identifiers_map[id];
+			} else {
+				identifier_pos = r_identifiers_map.size();
+				r_identifiers_map[id] = identifier_pos;
+			}
+			token_type |= identifier_pos << TOKEN_BITS;
+		} break;
+		case GDScriptTokenizer::Token::LITERAL: {
+			// Add literal to map.
+			uint32_t constant_pos;
+			if (r_constants_map.has(p_token.literal)) {
+				constant_pos = r_constants_map[p_token.literal];
+			} else {
+				constant_pos = r_constants_map.size();
+				r_constants_map[p_token.literal] = constant_pos;
+			}
+			token_type |= constant_pos << TOKEN_BITS;
+		} break;
+		default:
+			break;
+	}
+
+	// Tokens without payload fit in a single byte, the others use four with the top bit of the first one set.
+	int token_len;
+	if (token_type > TOKEN_MASK) {
+		token_len = 4;
+		r_buffer.resize(pos + token_len);
+		encode_uint32(token_type | TOKEN_BYTE_MASK, &r_buffer.write[pos]);
+	} else {
+		token_len = 1;
+		r_buffer.resize(pos + token_len);
+		r_buffer.write[pos] = token_type;
+	}
+
+	return token_len;
+}
+
+Error GDScriptTokenizerBuffer::_binary_to_token(const uint8_t *p_buffer, int p_len, int &r_read, Token &r_token) const {
+	ERR_FAIL_COND_V(p_len < 1, ERR_INVALID_DATA);
+
+	uint32_t token_type;
+	if (p_buffer[0] & TOKEN_BYTE_MASK) {
+		ERR_FAIL_COND_V(p_len < 4, ERR_INVALID_DATA);
+		token_type = decode_uint32(p_buffer) & ~uint32_t(TOKEN_BYTE_MASK);
+		r_read = 4;
+	} else {
+		token_type = p_buffer[0];
+		r_read = 1;
+	}
+
+	Token::Type type = Token::Type(token_type & TOKEN_MASK);
+	ERR_FAIL_COND_V(type >= Token::TK_MAX, ERR_INVALID_DATA);
+	uint32_t index = token_type >> TOKEN_BITS;
+
+	r_token = Token(type);
+	switch (type) {
+		case Token::ANNOTATION:
+		case Token::IDENTIFIER: {
+			ERR_FAIL_COND_V(index >= (uint32_t)identifiers.size(), ERR_INVALID_DATA);
+			r_token.literal = identifiers[index];
+			r_token.source = identifiers[index];
+		} break;
+		case Token::LITERAL: {
+			ERR_FAIL_COND_V(index >= (uint32_t)constants.size(), ERR_INVALID_DATA);
+			r_token.literal = constants[index];
+		} break;
+		default: {
+			// Keywords can be used as identifiers in some places, which is read from the token source.
+			if (r_token.is_node_name()) {
+				r_token.source = type == Token::CONST_NAN ? String("NAN") : get_token_name(type);
+			}
+		} break;
+	}
+
+	return OK;
+}
+
+Error GDScriptTokenizerBuffer::set_code_buffer(const Vector<uint8_t> &p_buffer) {
+	const uint8_t *buf = p_buffer.ptr();
+	ERR_FAIL_COND_V(p_buffer.size() < HEADER_SIZE || buf[0] != 'G' || buf[1] != 'D' || buf[2] != 'S' || buf[3] != 'C', ERR_INVALID_DATA);
+
+	uint32_t version = decode_uint32(&buf[4]);
+	ERR_FAIL_COND_V_MSG(version != TOKENIZER_VERSION, ERR_INVALID_DATA, "Binary GDScript was exported with an incompatible version of the engine.");
+
+	uint32_t decompressed_size = decode_uint32(&buf[8]);
+
+	Vector<uint8_t> contents;
+	if (decompressed_size == 0) {
+		contents = p_buffer.slice(HEADER_SIZE);
+	} else {
+		contents.resize(decompressed_size);
+		int result = Compression::decompress(contents.ptrw(), contents.size(), &buf[HEADER_SIZE], p_buffer.size() - HEADER_SIZE, Compression::MODE_ZSTD);
+		ERR_FAIL_COND_V_MSG(result != (int)decompressed_size, ERR_INVALID_DATA, "Error decompressing binary GDScript.");
+	}
+
+	buf = contents.ptr();
+	int total_len = contents.size();
+	ERR_FAIL_COND_V(total_len < 16, ERR_INVALID_DATA);
+
+	uint32_t identifier_count = decode_uint32(&buf[0]);
+	uint32_t constant_count = decode_uint32(&buf[4]);
+	uint32_t line_count = decode_uint32(&buf[8]);
+	uint32_t token_count = decode_uint32(&buf[12]);
+	int offset = 16;
+
+	identifiers.resize(identifier_count);
+	for (uint32_t i = 0; i < identifier_count; i++) {
+		ERR_FAIL_COND_V(total_len - offset < 4, ERR_INVALID_DATA);
+		uint32_t len = decode_uint32(&buf[offset]);
+		offset += 4;
+		ERR_FAIL_COND_V(len > uint32_t(total_len - offset), ERR_INVALID_DATA);
+		String s;
+		s.parse_utf8((const char *)&buf[offset], len);
+		identifiers.write[i] = s;
+		offset += len;
+	}
+
+	constants.resize(constant_count);
+	for (uint32_t i = 0; i < constant_count; i++) {
+		Variant v;
+		int len;
+		Error err = decode_variant(v, &buf[offset], total_len - offset, &len, false);
+		if (err) {
+			return err;
+		}
+		constants.write[i] = v;
+		offset += len;
+	}
+
+	ERR_FAIL_COND_V(uint64_t(line_count) * 12 > uint64_t(total_len - offset), ERR_INVALID_DATA);
+	for (uint32_t i = 0; i < line_count; i++) {
+		int token_index = decode_uint32(&buf[offset]);
+		token_lines[token_index] = decode_uint32(&buf[offset + 4]);
+		token_columns[token_index] = decode_uint32(&buf[offset + 8]);
+		offset += 12;
+	}
+
+	tokens.resize(token_count);
+	for (uint32_t i = 0; i < token_count; i++) {
+		int read;
+		Error err = _binary_to_token(&buf[offset], total_len - offset, read, tokens.write[i]);
+		if (err) {
+			return err;
+		}
+		offset += read;
+	}
+
+	ERR_FAIL_COND_V(offset != total_len, ERR_INVALID_DATA);
+
+	current = 0;
+	current_line = 1;
+
+	return OK;
+}
+
+Vector<uint8_t> GDScriptTokenizerBuffer::parse_code_string(const String &p_code, CompressMode p_compress_mode) {
+	struct LineStart {
+		uint32_t token = 0;
+		uint32_t line = 0;
+		uint32_t column = 0;
+	};
+
+	HashMap<StringName, uint32_t> identifier_map;
+	HashMap<Variant, uint32_t, VariantHasher, VariantComparator> constant_map;
+	Vector<uint8_t> token_buffer;
+	Vector<LineStart> line_starts;
+
+	GDScriptTokenizerText tokenizer;
+	tokenizer.set_source_code(p_code);
+	tokenizer.set_multiline_mode(true); // Ignore whitespace tokens, they are rebuilt from the line starts.
+
+	Token current = tokenizer.scan();
+	int token_pos = 0;
+	int token_count = 0;
+	int last_token_line = 0;
+
+	while (current.type != Token::TK_EOF) {
+		if (current.type == Token::ERROR) {
+			// Keep the script as text, so the error is reported when it's loaded.
+			return Vector<uint8_t>();
+		}
+		if (current.type == Token::NEWLINE || current.type == Token::INDENT || current.type == Token::DEDENT) {
+			current = tokenizer.scan();
+			continue;
+		}
+
+		token_pos += _token_to_binary(current, token_buffer, token_pos, identifier_map, constant_map);
+
+		if (current.start_line > last_token_line) {
+			LineStart line_start;
+			line_start.token = token_count;
+			line_start.line = current.start_line;
+			line_start.column = current.start_column;
+			line_starts.push_back(line_start);
+		}
+		last_token_line = current.end_line;
+
+		current = tokenizer.scan();
+		token_count++;
+	}
+
+	// Lines following a '\' continue the previous logical line.
+	HashSet<int> continuation_lines;
+	for (int line : tokenizer.get_continuation_lines()) {
+		continuation_lines.insert(line);
+	}
+
+	Vector<StringName> rev_identifier_map;
+	rev_identifier_map.resize(identifier_map.size());
+	for (const KeyValue<StringName, uint32_t> &E : identifier_map) {
+		rev_identifier_map.write[E.value] = E.key;
+	}
+
+	Vector<Variant> rev_constant_map;
+	rev_constant_map.resize(constant_map.size());
+	for (const KeyValue<Variant, uint32_t> &E : constant_map) {
+		rev_constant_map.write[E.value] = E.key;
+	}
+
+	Vector<uint8_t> contents;
+	contents.resize(16);
+	encode_uint32(rev_identifier_map.size(), &contents.write[0]);
+	encode_uint32(rev_constant_map.size(), &contents.write[4]);
+	encode_uint32(line_starts.size(), &contents.write[8]);
+	encode_uint32(token_count, &contents.write[12]);
+	int buf_pos = 16;
+
+	// Save identifiers.
+	for (const StringName &id : rev_identifier_map) {
+		CharString cs = String(id).utf8();
+		contents.resize(buf_pos + 4 + cs.length());
+		encode_uint32(cs.length(), &contents.write[buf_pos]);
+		memcpy(&contents.write[buf_pos + 4], cs.get_data(), cs.length());
+		buf_pos += 4 + cs.length();
+	}
+
+	// Save constants.
+	for (const Variant &v : rev_constant_map) {
+		int len;
+		Error err = encode_variant(v, nullptr, len, false);
+		ERR_FAIL_COND_V_MSG(err != OK, Vector<uint8_t>(), "Error when trying to encode Variant.");
+		contents.resize(buf_pos + len);
+		encode_variant(v, &contents.write[buf_pos], len, false);
+		buf_pos += len;
+	}
+
+	// Save line starts.
+	contents.resize(buf_pos + line_starts.size() * 12);
+	for (const LineStart &line_start : line_starts) {
+		encode_uint32(line_start.token, &contents.write[buf_pos]);
+		encode_uint32(line_start.line, &contents.write[buf_pos + 4]);
+		encode_uint32(continuation_lines.has(line_start.line) ? 0 : line_start.column, &contents.write[buf_pos + 8]);
+		buf_pos += 12;
+	}
+
+	// Save tokens.
+	contents.append_array(token_buffer);
+
+	Vector<uint8_t> buf;
+	buf.resize(HEADER_SIZE);
+	buf.write[0] = 'G';
+	buf.write[1] = 'D';
+	buf.write[2] = 'S';
+	buf.write[3] = 'C';
+	encode_uint32(TOKENIZER_VERSION, &buf.write[4]);
+
+	switch (p_compress_mode) {
+		case COMPRESS_NONE: {
+			encode_uint32(0u, &buf.write[8]);
+			buf.append_array(contents);
+		} break;
+		case COMPRESS_ZSTD: {
+			encode_uint32(contents.size(), &buf.write[8]);
+			Vector<uint8_t> compressed;
+			int max_size = Compression::get_max_compressed_buffer_size(contents.size(), Compression::MODE_ZSTD);
+			compressed.resize(max_size);
+
+			int compressed_size = Compression::compress(compressed.ptrw(), contents.ptr(), contents.size(), Compression::MODE_ZSTD);
+			ERR_FAIL_COND_V_MSG(compressed_size < 0, Vector<uint8_t>(), "Error compressing binary GDScript.");
+			compressed.resize(compressed_size);
+
+			buf.append_array(compressed);
+		} break;
+	}
+
+	return buf;
+}
+
+int GDScriptTokenizerBuffer::get_cursor_line() const {
+	return 0;
+}
+
+int GDScriptTokenizerBuffer::get_cursor_column() const {
+	return 0;
+}
+
+void GDScriptTokenizerBuffer::set_cursor_position(int p_line, int p_column) {
+}
+
+void GDScriptTokenizerBuffer::set_multiline_mode(bool p_state) {
+	multiline_mode = p_state;
+}
+
+bool GDScriptTokenizerBuffer::is_past_cursor() const {
+	return false;
+}
+
+void GDScriptTokenizerBuffer::push_expression_indented_block() {
+	indent_stack_stack.push_back(indent_stack);
+}
+
+void GDScriptTokenizerBuffer::pop_expression_indented_block() {
+	ERR_FAIL_COND(indent_stack_stack.size() == 0);
+	indent_stack = indent_stack_stack.back()->get();
+	indent_stack_stack.pop_back();
+}
+
+GDScriptTokenizer::Token GDScriptTokenizerBuffer::_make_whitespace_token(Token::Type p_type) const {
+	Token token(p_type);
+	token.start_line = current_line;
+	token.end_line = current_line;
+	return token;
+}
+
+GDScriptTokenizer::Token GDScriptTokenizerBuffer::scan() {
+	// Add final newline.
+	if (current >= tokens.size() && !last_token_was_newline) {
+		last_token_was_newline = true;
+		return _make_whitespace_token(Token::NEWLINE);
+	}
+
+	// Resolve pending indentation change.
+	if (pending_indents > 0) {
+		pending_indents--;
+		return _make_whitespace_token(Token::INDENT);
+	} else if (pending_indents < 0) {
+		pending_indents++;
+		return _make_whitespace_token(Token::DEDENT);
+	}
+
+	if (current >= tokens.size()) {
+		if (!indent_stack.is_empty()) {
+			pending_indents -= indent_stack.size();
+			indent_stack.clear();
+			return scan();
+		}
+		return _make_whitespace_token(Token::TK_EOF);
+	}
+
+	if (!last_token_was_newline && token_lines.has(current)) {
+		current_line = token_lines[current];
+		int current_column = token_columns[current];
+
+		// Continuation lines and lines inside expressions don't end the statement.
+		if (current > 0 && current_column > 0 && !multiline_mode) {
+			// Check if there's a need to indent/dedent.
+			int previous_indent = 0;
+			if (!indent_stack.is_empty()) {
+				previous_indent = indent_stack.back()->get();
+			}
+			if (current_column - 1 > previous_indent) {
+				pending_indents++;
+				indent_stack.push_back(current_column - 1);
+			} else {
+				while (current_column - 1 < previous_indent) {
+					pending_indents--;
+					indent_stack.pop_back();
+					if (indent_stack.is_empty()) {
+						break;
+					}
+					previous_indent = indent_stack.back()->get();
+				}
+			}
+
+			last_token_was_newline = true;
+			return _make_whitespace_token(Token::NEWLINE);
+		}
+	}
+
+	last_token_was_newline = false;
+
+	Token token = tokens[current++];
+	token.start_line = current_line;
+	token.end_line = current_line;
+	return token;
+}
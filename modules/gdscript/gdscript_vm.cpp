@@ -144,6 +144,367 @@ String GDScriptFunction::_get_call_error(const Callable::CallError &p_err, const
 	return err_text;
 }
 
+GDScriptInstance *GDScriptFunction::_inline_cache_get_receiver(Object *p_object, const GDScript *&r_script, bool &r_cacheable) {
+	r_script = nullptr;
+	r_cacheable = false;
+
+	ScriptInstance *si = p_object->get_script_instance();
+	if (!si) {
+		r_cacheable = true;
+		return nullptr;
+	}
+	if (si->is_placeholder() || si->get_language() != GDScriptLanguage::get_singleton()) {
+		return nullptr;
+	}
+
+	GDScriptInstance *instance = static_cast<GDScriptInstance *>(si);
+	r_script = instance->script.ptr();
+	r_cacheable = true;
+	return instance;
+}
+
+bool GDScriptFunction::_inline_cache_find(InlineCache *p_cache, Object *p_object, const GDScript *p_script, InlineCache::Hit &r_hit) {
+	const uint32_t epoch = p_cache->epoch.get();
+	if (unlikely(epoch != inline_cache_epoch.get())) {
+		return false;
+	}
+
+	bool found = false;
+	uint32_t count = p_cache->count.get();
+	for (uint32_t i = 0; i < count; i++) {
+		const InlineCache::Entry &entry = p_cache->entries[i];
+		if (entry.script != p_script) {
+			continue;
+		}
+		// Script members and functions don't depend on the native class of the owner.
+		if (entry.kind == InlineCache::KIND_SCRIPT_MEMBER || entry.kind == InlineCache::KIND_SCRIPT_FUNCTION || entry.native_class == p_object->get_class_name()) {
+			r_hit.kind = entry.kind;
+			r_hit.index = entry.index;
+			r_hit.member_type = entry.member_type;
+			r_hit.method = entry.method;
+			r_hit.function = entry.function;
+			found = true;
+			break;
+		}
+	}
+
+	// Another thread may have reset the cache for a new epoch while the entry was being read.
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return found && p_cache->epoch.get() == epoch;
+}
+
+bool GDScriptFunction::_inline_cache_should_update(InlineCache *p_cache) {
+	if (p_cache->epoch.get() != inline_cache_epoch.get()) {
+		return true;
+	}
+	return p_cache->count.get() < (uint32_t)InlineCache::MAX_ENTRIES && p_cache->failures.get() < InlineCache::MAX_FAILURES;
+}
+
+void GDScriptFunction::_inline_cache_sync_epoch(InlineCache *p_cache) {
+	// Must be called with `inline_cache_mutex` locked.
+	uint32_t epoch = inline_cache_epoch.get();
+	if (p_cache->epoch.get() != epoch) {
+		// Change the epoch before reusing the entries, so readers of the previous epoch notice.
+		p_cache->epoch.set(epoch);
+		p_cache->count.set(0);
+		p_cache->failures.set(0);
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+}
+
+void GDScriptFunction::_inline_cache_add_failure(InlineCache *p_cache) {
+	MutexLock lock(inline_cache_mutex);
+	// Failures belong to the current epoch too, otherwise sites that never resolve keep retrying.
+	_inline_cache_sync_epoch(p_cache);
+	p_cache->failures.increment();
+}
+
+void GDScriptFunction::_inline_cache_add(InlineCache *p_cache, const InlineCache::Entry &p_entry) {
+	MutexLock lock(inline_cache_mutex);
+	_inline_cache_sync_epoch(p_cache);
+
+	uint32_t count = p_cache->count.get();
+	if (count >= (uint32_t)InlineCache::MAX_ENTRIES) {
+		return;
+	}
+	// Publish the entry before making it visible to readers.
+	p_cache->entries[count] = p_entry;
+	p_cache->count.set(count + 1);
+}
+
+bool GDScriptFunction::_inline_cache_get(InlineCache *p_cache, const Variant *p_base, Variant &r_ret) {
+	if (p_base->get_type() != Variant::OBJECT || p_cache->count.get() == 0) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+
+	const GDScript *script;
+	bool cacheable;
+	GDScriptInstance *instance = _inline_cache_get_receiver(obj, script, cacheable);
+	if (!cacheable) {
+		return false;
+	}
+
+	InlineCache::Hit hit;
+	if (!_inline_cache_find(p_cache, obj, script, hit)) {
+		return false;
+	}
+
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(obj);
+#endif
+	if (hit.kind == InlineCache::KIND_SCRIPT_MEMBER) {
+		r_ret = instance->members[hit.index];
+	} else {
+		Callable::CallError ce;
+		r_ret = hit.method->call(obj, nullptr, 0, ce);
+	}
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_set(InlineCache *p_cache, Variant *p_base, const Variant &p_value) {
+	if (p_base->get_type() != Variant::OBJECT || p_cache->count.get() == 0) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+#ifdef TOOLS_ENABLED
+	// Object::set() also flags the object as edited, so only skip it once that's done.
+	if (!obj->is_edited()) {
+		return false;
+	}
+#endif
+
+	const GDScript *script;
+	bool cacheable;
+	GDScriptInstance *instance = _inline_cache_get_receiver(obj, script, cacheable);
+	if (!cacheable) {
+		return false;
+	}
+
+	InlineCache::Hit hit;
+	if (!_inline_cache_find(p_cache, obj, script, hit)) {
+		return false;
+	}
+
+	if (hit.kind == InlineCache::KIND_SCRIPT_MEMBER) {
+		if (hit.member_type && !hit.member_type->is_type(p_value)) {
+			// Let the slow path handle the conversion.
+			return false;
+		}
+		instance->members.write[hit.index] = p_value;
+		return true;
+	}
+
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(obj);
+#endif
+	Callable::CallError ce;
+	if (hit.index >= 0) {
+		Variant index = hit.index;
+		const Variant *args[2] = { &index, &p_value };
+		hit.method->call(obj, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		hit.method->call(obj, args, 1, ce);
+	}
+	return ce.error == Callable::CallError::CALL_OK;
+}
+
+bool GDScriptFunction::_inline_cache_call(InlineCache *p_cache, Variant *p_base, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_base->get_type() != Variant::OBJECT || p_cache->count.get() == 0) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return false;
+	}
+
+	const GDScript *script;
+	bool cacheable;
+	GDScriptInstance *instance = _inline_cache_get_receiver(obj, script, cacheable);
+	if (!cacheable) {
+		return false;
+	}
+
+	InlineCache::Hit hit;
+	if (!_inline_cache_find(p_cache, obj, script, hit)) {
+		return false;
+	}
+
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(obj);
+#endif
+	if (hit.kind == InlineCache::KIND_SCRIPT_FUNCTION) {
+		r_ret = hit.function->call(instance, p_args, p_argcount, r_err);
+	} else {
+		r_ret = hit.method->call(obj, p_args, p_argcount, r_err);
+	}
+	return true;
+}
+
+// Extension instances can intercept get, set and calls, so their classes are never cached.
+// Since entries are keyed on the class name, checking this when filling the cache is enough.
+static bool _is_extension_class(const StringName &p_class) {
+	ClassDB::APIType api = ClassDB::get_api_type(p_class);
+	return api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION;
+}
+
+// Returns true if the script handles `p_name` itself in `GDScriptInstance::get()` or `set()`
+// before the native class gets a chance to.
+bool GDScriptFunction::_inline_cache_script_claims_name(const GDScript *p_script, const StringName &p_name, bool p_set) {
+	if (p_script->member_indices.has(p_name)) {
+		return true;
+	}
+	const StringName &handler = p_set ? GDScriptLanguage::get_singleton()->strings._set : GDScriptLanguage::get_singleton()->strings._get;
+	for (const GDScript *sptr = p_script; sptr; sptr = sptr->_base) {
+		if (sptr->static_variables_indices.has(p_name) || sptr->member_functions.has(handler)) {
+			return true;
+		}
+		if (!p_set && (sptr->constants.has(p_name) || sptr->_signals.has(p_name) || sptr->member_functions.has(p_name) || sptr->subclasses.has(p_name))) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void GDScriptFunction::_inline_cache_update_get(InlineCache *p_cache, const Variant *p_base, const StringName &p_name) {
+	if (p_base->get_type() != Variant::OBJECT || !_inline_cache_should_update(p_cache)) {
+		return;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return;
+	}
+
+	const GDScript *script;
+	bool cacheable;
+	_inline_cache_get_receiver(obj, script, cacheable);
+	cacheable = cacheable && !_is_extension_class(obj->get_class_name());
+
+	InlineCache::Entry entry;
+	entry.script = script;
+	entry.native_class = obj->get_class_name();
+
+	if (cacheable && script) {
+		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+		if (E && !E->value.getter) {
+			entry.kind = InlineCache::KIND_SCRIPT_MEMBER;
+			entry.index = E->value.index;
+			_inline_cache_add(p_cache, entry);
+			return;
+		}
+	}
+
+	if (cacheable && (!script || !_inline_cache_script_claims_name(script, p_name, false))) {
+		const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(entry.native_class, p_name);
+		if (psg && psg->_getptr && psg->index < 0) {
+			entry.kind = InlineCache::KIND_NATIVE_PROPERTY;
+			entry.method = psg->_getptr;
+			_inline_cache_add(p_cache, entry);
+			return;
+		}
+	}
+
+	_inline_cache_add_failure(p_cache);
+}
+
+void GDScriptFunction::_inline_cache_update_set(InlineCache *p_cache, const Variant *p_base, const StringName &p_name) {
+	if (p_base->get_type() != Variant::OBJECT || !_inline_cache_should_update(p_cache)) {
+		return;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return;
+	}
+
+	const GDScript *script;
+	bool cacheable;
+	_inline_cache_get_receiver(obj, script, cacheable);
+	cacheable = cacheable && !_is_extension_class(obj->get_class_name());
+
+	InlineCache::Entry entry;
+	entry.script = script;
+	entry.native_class = obj->get_class_name();
+
+	if (cacheable && script) {
+		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+		if (E && !E->value.setter) {
+			entry.kind = InlineCache::KIND_SCRIPT_MEMBER;
+			entry.index = E->value.index;
+			entry.member_type = E->value.data_type.has_type ? &E->value.data_type : nullptr;
+			_inline_cache_add(p_cache, entry);
+			return;
+		}
+	}
+
+	if (cacheable && (!script || !_inline_cache_script_claims_name(script, p_name, true))) {
+		const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(entry.native_class, p_name);
+		if (psg && psg->_setptr) {
+			entry.kind = InlineCache::KIND_NATIVE_PROPERTY;
+			entry.index = psg->index;
+			entry.method = psg->_setptr;
+			_inline_cache_add(p_cache, entry);
+			return;
+		}
+	}
+
+	_inline_cache_add_failure(p_cache);
+}
+
+void GDScriptFunction::_inline_cache_update_call(InlineCache *p_cache, const Variant *p_base, const StringName &p_name) {
+	if (p_base->get_type() != Variant::OBJECT || !_inline_cache_should_update(p_cache)) {
+		return;
+	}
+	// Both have special handling in Object::callp() and GDScriptInstance::callp().
+	if (p_name == CoreStringNames::get_singleton()->_free || p_name == SNAME("_ready")) {
+		_inline_cache_add_failure(p_cache);
+		return;
+	}
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return;
+	}
+
+	const GDScript *script;
+	bool cacheable;
+	_inline_cache_get_receiver(obj, script, cacheable);
+	cacheable = cacheable && !_is_extension_class(obj->get_class_name());
+	if (!cacheable) {
+		_inline_cache_add_failure(p_cache);
+		return;
+	}
+
+	InlineCache::Entry entry;
+	entry.script = script;
+	entry.native_class = obj->get_class_name();
+
+	for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+		HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_name);
+		if (E) {
+			entry.kind = InlineCache::KIND_SCRIPT_FUNCTION;
+			entry.function = E->value;
+			_inline_cache_add(p_cache, entry);
+			return;
+		}
+	}
+
+	MethodBind *method = ClassDB::get_method(entry.native_class, p_name);
+	if (method) {
+		entry.kind = InlineCache::KIND_METHOD_BIND;
+		entry.method = method;
+		_inline_cache_add(p_cache, entry);
+		return;
+	}
+
+	_inline_cache_add_failure(p_cache);
+}
+
 void (*type_init_function_table[])(Variant *) = {
 	nullptr, // NIL (shouldn't be called).
 	&VariantInitializer<bool>::init, // BOOL.
@@ -190,6 +551,29 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {        \
 		&&OPCODE_OPERATOR,                           \
 		&&OPCODE_OPERATOR_VALIDATED,                 \
+		&&OPCODE_ADD_INT,                            \
+		&&OPCODE_SUBTRACT_INT,                       \
+		&&OPCODE_MULTIPLY_INT,                       \
+		&&OPCODE_NEGATE_INT,                         \
+		&&OPCODE_INCREMENT_INT,                      \
+		&&OPCODE_DECREMENT_INT,                      \
+		&&OPCODE_EQUAL_INT,                          \
+		&&OPCODE_NOT_EQUAL_INT,                      \
+		&&OPCODE_LESS_INT,                           \
+		&&OPCODE_LESS_EQUAL_INT,                     \
+		&&OPCODE_GREATER_INT,                        \
+		&&OPCODE_GREATER_EQUAL_INT,                  \
+		&&OPCODE_ADD_FLOAT,                          \
+		&&OPCODE_SUBTRACT_FLOAT,                     \
+		&&OPCODE_MULTIPLY_FLOAT,                     \
+		&&OPCODE_DIVIDE_FLOAT,                       \
+		&&OPCODE_NEGATE_FLOAT,                       \
+		&&OPCODE_EQUAL_FLOAT,                        \
+		&&OPCODE_NOT_EQUAL_FLOAT,                    \
+		&&OPCODE_LESS_FLOAT,                         \
+		&&OPCODE_LESS_EQUAL_FLOAT,                   \
+		&&OPCODE_GREATER_FLOAT,                      \
+		&&OPCODE_GREATER_EQUAL_FLOAT,                \
 		&&OPCODE_TYPE_TEST_BUILTIN,                  \
 		&&OPCODE_TYPE_TEST_ARRAY,                    \
 		&&OPCODE_TYPE_TEST_NATIVE,                   \
@@ -206,6 +590,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_GET_NAMED_VALIDATED,                \
 		&&OPCODE_SET_MEMBER,                         \
 		&&OPCODE_GET_MEMBER,                         \
+		&&OPCODE_SET_MEMBER_OPERATOR_VALIDATED,      \
 		&&OPCODE_SET_STATIC_VARIABLE,                \
 		&&OPCODE_GET_STATIC_VARIABLE,                \
 		&&OPCODE_ASSIGN,                             \
@@ -280,6 +665,18 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP,                               \
 		&&OPCODE_JUMP_IF,                            \
 		&&OPCODE_JUMP_IF_NOT,                        \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_INT,              \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_INT,          \
+		&&OPCODE_JUMP_IF_NOT_LESS_INT,               \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_INT,         \
+		&&OPCODE_JUMP_IF_NOT_GREATER_INT,            \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_INT,      \
+		&&OPCODE_JUMP_IF_NOT_EQUAL_FLOAT,            \
+		&&OPCODE_JUMP_IF_NOT_NOT_EQUAL_FLOAT,        \
+		&&OPCODE_JUMP_IF_NOT_LESS_FLOAT,             \
+		&&OPCODE_JUMP_IF_NOT_LESS_EQUAL_FLOAT,       \
+		&&OPCODE_JUMP_IF_NOT_GREATER_FLOAT,          \
+		&&OPCODE_JUMP_IF_NOT_GREATER_EQUAL_FLOAT,    \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,               \
 		&&OPCODE_JUMP_IF_SHARED,                     \
 		&&OPCODE_RETURN,                             \
@@ -780,6 +1177,54 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_TYPED_OPERATOR(m_name, m_type, m_get_func, m_ret_get_func, m_operator) \
+	OPCODE(OPCODE_##m_name##_##m_type) {                                               \
+		CHECK_SPACE(4);                                                                \
+		GET_VARIANT_PTR(a, 0);                                                         \
+		GET_VARIANT_PTR(b, 1);                                                         \
+		GET_VARIANT_PTR(dst, 2);                                                       \
+		const auto left = *VariantInternal::m_get_func(a);                             \
+		const auto right = *VariantInternal::m_get_func(b);                            \
+		*VariantInternal::m_ret_get_func(dst) = left m_operator right;                 \
+		ip += 4;                                                                       \
+	}                                                                                  \
+	DISPATCH_OPCODE
+
+#define OPCODE_TYPED_UNARY_OPERATOR(m_name, m_type, m_get_func, m_expression) \
+	OPCODE(OPCODE_##m_name##_##m_type) {                                       \
+		CHECK_SPACE(3);                                                        \
+		GET_VARIANT_PTR(a, 0);                                                 \
+		GET_VARIANT_PTR(dst, 1);                                               \
+		const auto value = *VariantInternal::m_get_func(a);                    \
+		*VariantInternal::m_get_func(dst) = m_expression;                      \
+		ip += 3;                                                               \
+	}                                                                          \
+	DISPATCH_OPCODE
+
+			OPCODE_TYPED_OPERATOR(ADD, INT, get_int, get_int, +);
+			OPCODE_TYPED_OPERATOR(SUBTRACT, INT, get_int, get_int, -);
+			OPCODE_TYPED_OPERATOR(MULTIPLY, INT, get_int, get_int, *);
+			OPCODE_TYPED_UNARY_OPERATOR(NEGATE, INT, get_int, -value);
+			OPCODE_TYPED_UNARY_OPERATOR(INCREMENT, INT, get_int, value + 1);
+			OPCODE_TYPED_UNARY_OPERATOR(DECREMENT, INT, get_int, value - 1);
+			OPCODE_TYPED_OPERATOR(EQUAL, INT, get_int, get_bool, ==);
+			OPCODE_TYPED_OPERATOR(NOT_EQUAL, INT, get_int, get_bool, !=);
+			OPCODE_TYPED_OPERATOR(LESS, INT, get_int, get_bool, <);
+			OPCODE_TYPED_OPERATOR(LESS_EQUAL, INT, get_int, get_bool, <=);
+			OPCODE_TYPED_OPERATOR(GREATER, INT, get_int, get_bool, >);
+			OPCODE_TYPED_OPERATOR(GREATER_EQUAL, INT, get_int, get_bool, >=);
+			OPCODE_TYPED_OPERATOR(ADD, FLOAT, get_float, get_float, +);
+			OPCODE_TYPED_OPERATOR(SUBTRACT, FLOAT, get_float, get_float, -);
+			OPCODE_TYPED_OPERATOR(MULTIPLY, FLOAT, get_float, get_float, *);
+			OPCODE_TYPED_OPERATOR(DIVIDE, FLOAT, get_float, get_float, /);
+			OPCODE_TYPED_UNARY_OPERATOR(NEGATE, FLOAT, get_float, -value);
+			OPCODE_TYPED_OPERATOR(EQUAL, FLOAT, get_float, get_bool, ==);
+			OPCODE_TYPED_OPERATOR(NOT_EQUAL, FLOAT, get_float, get_bool, !=);
+			OPCODE_TYPED_OPERATOR(LESS, FLOAT, get_float, get_bool, <);
+			OPCODE_TYPED_OPERATOR(LESS_EQUAL, FLOAT, get_float, get_bool, <=);
+			OPCODE_TYPED_OPERATOR(GREATER, FLOAT, get_float, get_bool, >);
+			OPCODE_TYPED_OPERATOR(GREATER_EQUAL, FLOAT, get_float, get_bool, >=);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1071,7 +1516,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1081,8 +1526,15 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_cache_count);
+				InlineCache *cache = &_inline_caches_ptr[cache_idx];
+
+				bool valid = true;
+				if (!_inline_cache_set(cache, dst, *value)) {
+					_inline_cache_update_set(cache, dst, *index);
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1099,7 +1551,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1119,7 +1571,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1129,22 +1581,25 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_cache_count);
+				InlineCache *cache = &_inline_caches_ptr[cache_idx];
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				// Evaluate into a temporary since src and dst may be the same stack position.
+				bool valid = true;
+				Variant ret;
+				if (!_inline_cache_get(cache, src, ret)) {
+					_inline_cache_update_get(cache, src, *index);
+					ret = src->get_named(*index, valid);
+				}
 #ifdef DEBUG_ENABLED
 				if (!valid) {
 					err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
 					OPCODE_BREAK;
 				}
-				*dst = ret;
 #endif
-				ip += 4;
+				*dst = ret;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1206,6 +1661,47 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_SET_MEMBER_OPERATOR_VALIDATED) {
+				CHECK_SPACE(6);
+				GET_VARIANT_PTR(value, 0);
+				GET_VARIANT_PTR(dst, 1);
+				int indexname = _code_ptr[ip + 3];
+				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
+				const StringName *index = &_global_names_ptr[indexname];
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+				Variant::Type ret_type = (Variant::Type)_code_ptr[ip + 5];
+
+				Variant member;
+				bool valid;
+#ifndef DEBUG_ENABLED
+				ClassDB::get_property(p_instance->owner, *index, member);
+#else
+				bool ok = ClassDB::get_property(p_instance->owner, *index, member);
+				if (!ok) {
+					err_text = "Internal error getting property: " + String(*index);
+					OPCODE_BREAK;
+				}
+#endif
+				VariantInternal::initialize(dst, ret_type);
+				operator_func(&member, value, dst);
+#ifndef DEBUG_ENABLED
+				ClassDB::set_property(p_instance->owner, *index, *dst, &valid);
+#else
+				ok = ClassDB::set_property(p_instance->owner, *index, *dst, &valid);
+				if (!ok) {
+					err_text = "Internal error setting property: " + String(*index);
+					OPCODE_BREAK;
+				} else if (!valid) {
+					err_text = "Error setting property '" + String(*index) + "' with value of type " + Variant::get_type_name(dst->get_type()) + ".";
+					OPCODE_BREAK;
+				}
+#endif
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_STATIC_VARIABLE) {
 				CHECK_SPACE(4);
 
@@ -1670,7 +2166,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1684,6 +2180,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_cache_count);
+				InlineCache *cache = &_inline_caches_ptr[cache_idx];
+
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
@@ -1700,7 +2200,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Object *base_obj = base->get_validated_object();
 					StringName base_class = base_obj ? base_obj->get_class_name() : StringName();
 #endif
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (!_inline_cache_call(cache, base, (const Variant **)argptrs, argc, *ret, err)) {
+						_inline_cache_update_call(cache, base, *methodname);
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1730,7 +2233,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
-					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					if (!_inline_cache_call(cache, base, (const Variant **)argptrs, argc, ret, err)) {
+						_inline_cache_update_call(cache, base, *methodname);
+						base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling) {
@@ -1775,7 +2281,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2568,6 +3074,36 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_JUMP_IF_NOT_COMPARE(m_name, m_type, m_get_func, m_operator) \
+	OPCODE(OPCODE_JUMP_IF_NOT_##m_name##_##m_type) {                        \
+		CHECK_SPACE(4);                                                     \
+		GET_VARIANT_PTR(a, 0);                                              \
+		GET_VARIANT_PTR(b, 1);                                              \
+		const auto left = *VariantInternal::m_get_func(a);                  \
+		const auto right = *VariantInternal::m_get_func(b);                 \
+		if (!(left m_operator right)) {                                     \
+			int to = _code_ptr[ip + 3];                                     \
+			GD_ERR_BREAK(to < 0 || to > _code_size);                        \
+			ip = to;                                                        \
+		} else {                                                            \
+			ip += 4;                                                        \
+		}                                                                   \
+	}                                                                       \
+	DISPATCH_OPCODE
+
+			OPCODE_JUMP_IF_NOT_COMPARE(EQUAL, INT, get_int, ==);
+			OPCODE_JUMP_IF_NOT_COMPARE(NOT_EQUAL, INT, get_int, !=);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS, INT, get_int, <);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS_EQUAL, INT, get_int, <=);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER, INT, get_int, >);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL, INT, get_int, >=);
+			OPCODE_JUMP_IF_NOT_COMPARE(EQUAL, FLOAT, get_float, ==);
+			OPCODE_JUMP_IF_NOT_COMPARE(NOT_EQUAL, FLOAT, get_float, !=);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS, FLOAT, get_float, <);
+			OPCODE_JUMP_IF_NOT_COMPARE(LESS_EQUAL, FLOAT, get_float, <=);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER, FLOAT, get_float, >);
+			OPCODE_JUMP_IF_NOT_COMPARE(GREATER_EQUAL, FLOAT, get_float, >=);
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
@@ -34,6 +34,7 @@
 #include "gdscript_analyzer.h"
 #include "gdscript_cache.h"
 #include "gdscript_tokenizer.h"
+#include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
 
 #ifdef TOOLS_ENABLED
@@ -81,7 +82,17 @@ Ref<GDScriptEditorTranslationParserPlugin> gdscript_translation_parser_plugin;
 class EditorExportGDScript : public EditorExportPlugin {
 	GDCLASS(EditorExportGDScript, EditorExportPlugin);
 
+	enum ScriptExportMode {
+		SCRIPT_EXPORT_MODE_TEXT,
+		SCRIPT_EXPORT_MODE_BINARY_TOKENS,
+		SCRIPT_EXPORT_MODE_COMPRESSED_BINARY_TOKENS,
+	};
+
 public:
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::INT, "gdscript/export_mode", PROPERTY_HINT_ENUM, "Text,Binary Tokens,Compressed Binary Tokens"), SCRIPT_EXPORT_MODE_COMPRESSED_BINARY_TOKENS));
+	}
+
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
 		String script_key;
 
@@ -95,7 +106,29 @@ public:
 			return;
 		}
 
-		return;
+		int script_mode = SCRIPT_EXPORT_MODE_COMPRESSED_BINARY_TOKENS;
+		if (preset.is_valid()) {
+			script_mode = get_option("gdscript/export_mode");
+		}
+		if (script_mode == SCRIPT_EXPORT_MODE_TEXT) {
+			return;
+		}
+
+		Vector<uint8_t> file = FileAccess::get_file_as_bytes(p_path);
+		if (file.is_empty()) {
+			return;
+		}
+
+		String source;
+		source.parse_utf8(reinterpret_cast<const char *>(file.ptr()), file.size());
+		GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == SCRIPT_EXPORT_MODE_COMPRESSED_BINARY_TOKENS ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE;
+		file = GDScriptTokenizerBuffer::parse_code_string(source, compress_mode);
+		if (file.is_empty()) {
+			// Scripts the tokenizer can't handle are exported as text, so they report their errors when loaded.
+			return;
+		}
+
+		add_file(p_path.get_basename() + ".gdc", file, true);
 	}
 
 	virtual String get_name() const override { return "GDScript"; }
@@ -31,6 +31,8 @@
 #ifndef GDSCRIPT_TEST_RUNNER_SUITE_H
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
+#include "../gdscript_parser.h"
+#include "../gdscript_tokenizer_buffer.h"
 #include "gdscript_test_runner.h"
 
 #include "tests/test_macros.h"
@@ -71,6 +73,71 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Load binary tokens and run them") {
+	const String source = R"(
+extends RefCounted
+
+const GREETING = "hello"
+
+func _init():
+	var total := 0
+	for i in range(4):
+		if i % 2 == 0:
+			total += i
+		else:
+			total += \
+				i * 10
+	var add := func(a, b):
+		return a + b
+	set_meta("result", add.call(total, 0.5))
+	set_meta("greeting", GREETING + " " + str(PI > 3))
+)";
+
+	const GDScriptTokenizerBuffer::CompressMode modes[] = { GDScriptTokenizerBuffer::COMPRESS_NONE, GDScriptTokenizerBuffer::COMPRESS_ZSTD };
+	for (GDScriptTokenizerBuffer::CompressMode mode : modes) {
+		const Vector<uint8_t> binary_tokens = GDScriptTokenizerBuffer::parse_code_string(source, mode);
+		REQUIRE_MESSAGE(!binary_tokens.is_empty(), "The script should be converted to binary tokens.");
+
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_binary_tokens_source(binary_tokens);
+		// Silence the spurious `Condition "err" is true` message, see above.
+		ERR_PRINT_OFF;
+		const Error error = gdscript->reload();
+		ERR_PRINT_ON;
+		CHECK_MESSAGE(error == OK, "The binary tokens should parse successfully.");
+
+		Ref<RefCounted> ref_counted = memnew(RefCounted);
+		ref_counted->set_script(gdscript);
+		CHECK_MESSAGE(double(ref_counted->get_meta("result")) == doctest::Approx(42.5), "Indentation and line continuations should be rebuilt from the binary tokens.");
+		CHECK_MESSAGE(String(ref_counted->get_meta("greeting")) == "hello true", "Identifiers, constants and literals should be read back from the binary tokens.");
+	}
+
+	CHECK_MESSAGE(GDScriptTokenizerBuffer::parse_code_string("var a = \"unterminated", GDScriptTokenizerBuffer::COMPRESS_NONE).is_empty(), "Scripts with tokenizer errors should not be converted.");
+}
+
+TEST_CASE("[Modules][GDScript] List script dependencies") {
+	GDScriptParser parser;
+	const Error error = parser.parse(R"(
+extends "base.gd"
+
+const Helper = preload("../shared/helper.gd")
+const Icon = preload("res://icon.svg")
+
+func _init():
+	var other = preload("helper.gd")
+	var again = preload("base.gd")
+)",
+			"res://scripts/main.gd", false);
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	List<String> dependencies = parser.get_dependencies();
+	CHECK_MESSAGE(dependencies.size() == 4, "Each dependency should be listed once.");
+	CHECK_MESSAGE(dependencies.find("res://scripts/base.gd") != nullptr, "The relative `extends` path should be resolved.");
+	CHECK_MESSAGE(dependencies.find("res://shared/helper.gd") != nullptr, "The relative preload path should be resolved.");
+	CHECK_MESSAGE(dependencies.find("res://scripts/helper.gd") != nullptr, "Preloads inside functions should be listed.");
+	CHECK_MESSAGE(dependencies.find("res://icon.svg") != nullptr, "Preloaded resources should be listed.");
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
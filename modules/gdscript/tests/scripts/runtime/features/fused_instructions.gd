@@ -0,0 +1,42 @@
+extends Node
+
+var untyped_member = 0
+
+func test():
+	# Typed comparisons used as branch conditions.
+	var i := 0
+	var evens := 0
+	while i < 10:
+		i += 1
+		if i == 5:
+			continue
+		if i % 2 == 0:
+			evens += 1
+		elif i >= 9:
+			break
+	print(i, " ", evens)
+
+	var x := 1.5
+	if x > 1.0:
+		print("greater")
+	else:
+		print("not greater")
+	if x <= 1.0:
+		print("less or equal")
+	else:
+		print("not less or equal")
+
+	# Compound assignments to native properties.
+	process_priority = 3
+	process_priority += 1
+	process_priority *= 5
+	process_priority -= i
+	print(process_priority)
+
+	# Operator results copied to their destination.
+	var a = 2
+	var b = 3
+	var c = a * b
+	a = a + b
+	untyped_member = c - a
+	print(a, " ", b, " ", c, " ", untyped_member)
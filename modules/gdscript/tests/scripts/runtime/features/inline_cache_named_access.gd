@@ -0,0 +1,76 @@
+class A:
+	var value = 1
+	func describe():
+		return "A %s" % value
+
+class B:
+	var value = "b"
+	func describe():
+		return "B %s" % value
+
+class C extends A:
+	func describe():
+		return "C " + super()
+
+class WithSetter:
+	var value = 1:
+		set(v):
+			value = v * 10
+	func describe():
+		return "WithSetter %s" % value
+
+class Typed:
+	var value: float = 1.0
+	func describe():
+		return "Typed %s" % (typeof(value) == TYPE_FLOAT)
+
+class Shadowed extends Resource:
+	func _get(property):
+		if property == &"resource_name":
+			return "from _get"
+		return null
+
+func get_value(obj):
+	return obj.value
+
+func set_value(obj, v):
+	obj.value = v
+
+func describe(obj):
+	return obj.describe()
+
+func get_resource_name(obj):
+	return obj.resource_name
+
+func set_resource_name(obj, v):
+	obj.resource_name = v
+
+func get_class_of(obj):
+	return obj.get_class()
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), WithSetter.new(), Typed.new(), A.new()]
+
+	# Run twice so the second pass goes through the filled caches.
+	for i in 2:
+		for obj in objects:
+			set_value(obj, get_value(obj) + get_value(obj))
+			print(describe(obj))
+
+	# Cached typed member still converts the assigned value.
+	set_value(objects[4], 3)
+	print(describe(objects[4]))
+
+	var plain := Resource.new()
+	plain.resource_name = "plain"
+	var shadowed := Shadowed.new()
+	shadowed.resource_name = "shadowed"
+	for i in 2:
+		print(get_resource_name(plain))
+		print(get_resource_name(shadowed))
+		print(get_class_of(plain), " ", get_class_of(shadowed), " ", get_class_of(objects[0]))
+
+	# Native property sets, the later ones going through the filled cache.
+	for i in 3:
+		set_resource_name(plain, "plain %d" % i)
+		print(plain.resource_name)
@@ -0,0 +1,38 @@
+# Sites that can't be cached stop trying after a few failures, and must keep working after that.
+
+class Dynamic:
+	var stored = {}
+	func _get(property):
+		if property == &"value":
+			return stored.get(property, 0)
+		return null
+	func _set(property, v):
+		if property == &"value":
+			stored[property] = v
+			return true
+		return false
+
+class Plain:
+	var value = 0
+
+func get_value(obj):
+	return obj.value
+
+func set_value(obj, v):
+	obj.value = v
+
+func test():
+	var dynamic := Dynamic.new()
+	var total = 0
+	for i in 20:
+		set_value(dynamic, get_value(dynamic) + i)
+		total += get_value(dynamic)
+	print(get_value(dynamic))
+	print(total)
+
+	# A receiver which could be cached, going through the sites that gave up.
+	var plain := Plain.new()
+	for i in 3:
+		set_value(plain, get_value(plain) + 1)
+	print(get_value(plain))
+	print(get_value(dynamic))
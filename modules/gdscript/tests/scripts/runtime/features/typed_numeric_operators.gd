@@ -0,0 +1,29 @@
+@warning_ignore("integer_division")
+func test():
+	var a := 7
+	var b := 3
+	print(a + b, " ", a - b, " ", a * b, " ", -a)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+	print(a / b, " ", a % b)
+
+	var x := 2.5
+	var y := 0.5
+	print(x + y, " ", x - y, " ", x * y, " ", x / y, " ", -x)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+
+	# Mixed operands still go through the validated evaluators.
+	print(a + x, " ", a < x)
+
+	var count := 0
+	var total := 0
+	for i in 10:
+		count += 1
+		total = total + i
+	while count > 0:
+		count -= 1
+	print(count, " ", total, " ", 1 + total)
+
+	var accum := 0.0
+	for i in 4:
+		accum = accum + y
+	print(accum)
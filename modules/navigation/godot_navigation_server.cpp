@@ -107,6 +107,7 @@ TypedArray<RID> GodotNavigationServer::get_maps() const {
 
 RID GodotNavigationServer::map_create() {
 	MutexLock lock(operations_mutex);
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 
 	RID rid = map_owner.make_rid();
 	NavMap *map = map_owner.get_or_null(rid);
@@ -333,6 +334,7 @@ RID GodotNavigationServer::agent_get_map(RID p_agent) const {
 
 RID GodotNavigationServer::region_create() {
 	MutexLock lock(operations_mutex);
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 
 	RID rid = region_owner.make_rid();
 	NavRegion *reg = region_owner.get_or_null(rid);
@@ -500,6 +502,7 @@ Vector3 GodotNavigationServer::region_get_connection_pathway_end(RID p_region, i
 
 RID GodotNavigationServer::link_create() {
 	MutexLock lock(operations_mutex);
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 
 	RID rid = link_owner.make_rid();
 	NavLink *link = link_owner.get_or_null(rid);
@@ -640,6 +643,7 @@ ObjectID GodotNavigationServer::link_get_owner_id(RID p_link) const {
 
 RID GodotNavigationServer::agent_create() {
 	MutexLock lock(operations_mutex);
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 
 	RID rid = agent_owner.make_rid();
 	NavAgent *agent = agent_owner.get_or_null(rid);
@@ -817,6 +821,7 @@ COMMAND_2(agent_set_avoidance_priority, RID, p_agent, real_t, p_priority) {
 
 RID GodotNavigationServer::obstacle_create() {
 	MutexLock lock(operations_mutex);
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 
 	RID rid = obstacle_owner.make_rid();
 	NavObstacle *obstacle = obstacle_owner.get_or_null(rid);
@@ -1069,6 +1074,7 @@ void GodotNavigationServer::flush_queries() {
 	// even with mutable functions.
 	MutexLock lock(commands_mutex);
 	MutexLock lock2(operations_mutex);
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 
 	for (SetCommand *command : commands) {
 		command->exec(this);
@@ -1083,6 +1089,7 @@ void GodotNavigationServer::map_force_update(RID p_map) {
 
 	flush_queries();
 
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
 	map->sync();
 }
 
@@ -1116,8 +1123,11 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 	// even with mutable functions.
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
-		active_maps[i]->sync();
-		active_maps[i]->step(p_delta_time);
+		{
+			Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
+			active_maps[i]->sync();
+			active_maps[i]->step(p_delta_time);
+		}
 		active_maps[i]->dispatch_callbacks();
 
 		_new_pm_region_count += active_maps[i]->get_pm_region_count();
@@ -1149,7 +1159,7 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 
 void GodotNavigationServer::init() {
 #ifndef _3D_DISABLED
-	navmesh_generator_3d = memnew(NavMeshGenerator3D);
+	navmesh_generator_3d = memnew_tagged(NavMeshGenerator3D, Memory::TAG_NAVIGATION);
 #endif // _3D_DISABLED
 }
 
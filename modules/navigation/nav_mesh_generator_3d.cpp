@@ -218,7 +218,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	baking_navmesh_mutex.unlock();
 
 	generator_task_mutex.lock();
-	NavMeshGeneratorTask3D *generator_task = memnew(NavMeshGeneratorTask3D);
+	NavMeshGeneratorTask3D *generator_task = memnew_tagged(NavMeshGeneratorTask3D, Memory::TAG_NAVIGATION);
 	generator_task->navigation_mesh = p_navigation_mesh;
 	generator_task->source_geometry_data = p_source_geometry_data;
 	generator_task->callback = p_callback;
@@ -613,6 +613,8 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		return;
 	}
 
+	Memory::TagScope tag_scope(Memory::TAG_NAVIGATION);
+
 	const Vector<float> &vertices = p_source_geometry_data->get_vertices();
 	const Vector<int> &indices = p_source_geometry_data->get_indices();
 
@@ -31,6 +31,7 @@
 #include "raycast_occlusion_cull.h"
 
 #include "core/config/project_settings.h"
+#include "core/math/math_simd.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 
@@ -385,9 +386,7 @@ void RaycastOcclusionCull::Scenario::_transform_vertices_thread(uint32_t p_threa
 }
 
 void RaycastOcclusionCull::Scenario::_transform_vertices_range(const Vector3 *p_read, Vector3 *p_write, const Transform3D &p_xform, int p_from, int p_to) {
-	for (int i = p_from; i < p_to; i++) {
-		p_write[i] = p_xform.xform(p_read[i]);
-	}
+	MathSIMD::transform(p_read + p_from, p_write + p_from, p_to - p_from, p_xform);
 }
 
 void RaycastOcclusionCull::Scenario::_commit_scene(void *p_ud) {
@@ -124,7 +124,7 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 			get_tree()->xform_change_list.add(&xform_change);
 		} else {
 			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
-			MessageQueue::get_singleton()->push_callable(callable_mp(this, &Node3D::_propagate_transform_changed_deferred));
+			MessageQueue::get_singleton()->push_native(this, &Node3D::_propagate_transform_changed_deferred);
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
 #include "core/math/geometry_2d.h"
+#include "core/math/math_simd.h"
 #include "core/math/triangulate.h"
 #include "scene/3d/importer_mesh_instance_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
@@ -529,9 +530,7 @@ void OccluderInstance3D::_bake_surface(const Transform3D &p_transform, Array p_s
 	}
 
 	Vector3 *vertices_ptr = vertices.ptrw();
-	for (int j = 0; j < vertices.size(); j++) {
-		vertices_ptr[j] = p_transform.xform(vertices_ptr[j]);
-	}
+	MathSIMD::transform(vertices_ptr, vertices_ptr, vertices.size(), p_transform);
 
 	if (!Math::is_zero_approx(p_simplification_dist) && SurfaceTool::simplify_func) {
 		Vector<float> vertices_f32 = vector3_to_float32_array(vertices.ptr(), vertices.size());
@@ -138,7 +138,7 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	MessageQueue::get_singleton()->push_native(this, &Container::_sort_children);
 	pending_sort = true;
 }
 
@@ -1625,7 +1625,7 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Control::_update_minimum_size));
+	MessageQueue::get_singleton()->push_native(this, &Control::_update_minimum_size);
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
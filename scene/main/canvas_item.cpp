@@ -400,7 +400,7 @@ void CanvasItem::queue_redraw() {
 
 	pending_update = true;
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &CanvasItem::_redraw_callback));
+	MessageQueue::get_singleton()->push_native(this, &CanvasItem::_redraw_callback);
 }
 
 void CanvasItem::move_to_front() {
@@ -893,7 +893,7 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 					get_tree()->xform_change_list.add(&p_node->xform_change);
 				} else {
 					// Should be rare, but still needs to be handled.
-					MessageQueue::get_singleton()->push_callable(callable_mp(p_node, &CanvasItem::_notify_transform_deferred));
+					MessageQueue::get_singleton()->push_native(p_node, &CanvasItem::_notify_transform_deferred);
 				}
 			}
 		}
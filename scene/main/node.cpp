@@ -424,8 +424,18 @@ void Node::_move_child(Node *p_child, int p_index, bool p_ignore_end) {
 	int motion_from = MIN(p_index, child_index);
 	int motion_to = MAX(p_index, child_index);
 
-	data.children_cache.remove_at(child_index);
-	data.children_cache.insert(p_index, p_child);
+	// Only shift the children in between.
+	Node **children = data.children_cache.ptr();
+	if (p_index < child_index) {
+		for (int i = child_index; i > p_index; i--) {
+			children[i] = children[i - 1];
+		}
+	} else {
+		for (int i = child_index; i < p_index; i++) {
+			children[i] = children[i + 1];
+		}
+	}
+	children[p_index] = p_child;
 
 	if (data.tree) {
 		data.tree->tree_changed();
@@ -877,6 +887,26 @@ void Node::set_process_internal(bool p_process_internal) {
 	}
 }
 
+void Node::set_process_batch(int p_batch) {
+	ERR_THREAD_GUARD
+	if (data.process_batch == p_batch) {
+		return;
+	}
+	if (!is_inside_tree()) {
+		// Not yet in the tree; trivial update.
+		data.process_batch = p_batch;
+		return;
+	}
+
+	if (_is_any_processing()) {
+		_remove_from_process_thread_group();
+		data.process_batch = p_batch;
+		_add_to_process_thread_group();
+	} else {
+		data.process_batch = p_batch;
+	}
+}
+
 void Node::_add_process_group() {
 	get_tree()->_add_process_group(this);
 }
@@ -955,6 +985,15 @@ int Node::get_process_thread_group_order() const {
 	return data.process_thread_group_order;
 }
 
+void Node::set_process_thread_group_auto_partition(bool p_enable) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Changing the process thread group partitioning can only be done from the main thread. Use call_deferred(\"set_process_thread_group_auto_partition\",enable).");
+	data.process_thread_group_auto_partition = p_enable;
+}
+
+bool Node::is_process_thread_group_auto_partition_enabled() const {
+	return data.process_thread_group_auto_partition;
+}
+
 void Node::set_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.process_priority == p_priority) {
@@ -1359,27 +1398,32 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 	data.children.insert(p_name, p_child);
 
 	p_child->data.internal_mode = p_internal_mode;
+
+	// Children are added at the end of their range, which can be done while there are holes only if it's also the end of the array.
+	if (p_internal_mode == INTERNAL_MODE_FRONT || (p_internal_mode == INTERNAL_MODE_DISABLED && data.internal_children_back_count_cache > 0)) {
+		_update_children_cache();
+	}
 	switch (p_internal_mode) {
 		case INTERNAL_MODE_FRONT: {
 			p_child->data.index = data.internal_children_front_count_cache++;
+			data.children_cache.insert(p_child->data.index, p_child);
 		} break;
 		case INTERNAL_MODE_BACK: {
 			p_child->data.index = data.internal_children_back_count_cache++;
+			data.children_cache.push_back(p_child);
 		} break;
 		case INTERNAL_MODE_DISABLED: {
 			p_child->data.index = data.external_children_count_cache++;
+			if (data.internal_children_back_count_cache == 0) {
+				data.children_cache.push_back(p_child);
+			} else {
+				data.children_cache.insert(data.internal_children_front_count_cache + p_child->data.index, p_child);
+			}
 		} break;
 	}
 
 	p_child->data.parent = this;
 
-	if (!data.children_cache_dirty && p_internal_mode == INTERNAL_MODE_DISABLED && data.internal_children_back_count_cache == 0) {
-		// Special case, also add to the cached children array since its cheap.
-		data.children_cache.push_back(p_child);
-	} else {
-		data.children_cache_dirty = true;
-	}
-
 	p_child->notification(NOTIFICATION_PARENTED);
 
 	if (data.tree) {
@@ -1430,12 +1474,11 @@ void Node::remove_child(Node *p_child) {
 
 	/**
 	 *  Do not change the data.internal_children*cache counters here.
-	 *  Because if nodes are re-added, the indices can remain
-	 *  greater-than-everything indices and children added remain
-	 *  properly ordered.
+	 *  The child only leaves a hole in the cache, so the position of
+	 *  the other children (and their indices) remain valid.
 	 *
 	 *  All children indices and counters will be updated next time the
-	 *  cache is re-generated.
+	 *  cache is compacted.
 	 */
 
 	data.blocked++;
@@ -1447,7 +1490,24 @@ void Node::remove_child(Node *p_child) {
 
 	data.blocked--;
 
+	uint32_t position = p_child->data.index;
+	switch (p_child->data.internal_mode) {
+		case INTERNAL_MODE_DISABLED: {
+			position += data.internal_children_front_count_cache;
+		} break;
+		case INTERNAL_MODE_BACK: {
+			position += data.internal_children_front_count_cache + data.external_children_count_cache;
+		} break;
+		case INTERNAL_MODE_FRONT: {
+		} break;
+	}
+	ERR_FAIL_COND_MSG(position >= data.children_cache.size() || data.children_cache[position] != p_child, "Children cache does not match the child index, this is a bug.");
+	data.children_cache[position] = nullptr;
+	if (!data.children_cache_dirty || position < data.children_cache_dirty_from) {
+		data.children_cache_dirty_from = position;
+	}
 	data.children_cache_dirty = true;
+
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
 
@@ -1463,33 +1523,33 @@ void Node::remove_child(Node *p_child) {
 }
 
 void Node::_update_children_cache_impl() const {
-	// Assign children
-	data.children_cache.resize(data.children.size());
-	int idx = 0;
-	for (const KeyValue<StringName, Node *> &K : data.children) {
-		data.children_cache[idx] = K.value;
-		idx++;
-	}
-	// Sort them
-	data.children_cache.sort_custom<ComparatorByIndex>();
-	// Update indices
-	data.external_children_count_cache = 0;
-	data.internal_children_back_count_cache = 0;
-	data.internal_children_front_count_cache = 0;
-
-	for (uint32_t i = 0; i < data.children_cache.size(); i++) {
-		switch (data.children_cache[i]->data.internal_mode) {
+	// Children before the first hole are already in place, so only compact the rest.
+	const int from = data.children_cache_dirty_from;
+	const int front_count = data.internal_children_front_count_cache;
+	data.internal_children_front_count_cache = MIN(from, front_count);
+	data.external_children_count_cache = CLAMP(from - front_count, 0, data.external_children_count_cache);
+	data.internal_children_back_count_cache = from - data.internal_children_front_count_cache - data.external_children_count_cache;
+
+	uint32_t to = from;
+	for (uint32_t i = from; i < data.children_cache.size(); i++) {
+		Node *child = data.children_cache[i];
+		if (!child) {
+			continue;
+		}
+		data.children_cache[to++] = child;
+		switch (child->data.internal_mode) {
 			case INTERNAL_MODE_DISABLED: {
-				data.children_cache[i]->data.index = data.external_children_count_cache++;
+				child->data.index = data.external_children_count_cache++;
 			} break;
 			case INTERNAL_MODE_FRONT: {
-				data.children_cache[i]->data.index = data.internal_children_front_count_cache++;
+				child->data.index = data.internal_children_front_count_cache++;
 			} break;
 			case INTERNAL_MODE_BACK: {
-				data.children_cache[i]->data.index = data.internal_children_back_count_cache++;
+				child->data.index = data.internal_children_back_count_cache++;
 			} break;
 		}
 	}
+	data.children_cache.resize(to);
 	data.children_cache_dirty = false;
 }
 
@@ -3137,6 +3197,9 @@ void Node::_validate_property(PropertyInfo &p_property) const {
 	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 		p_property.usage = 0;
 	}
+	if (p_property.name == "process_thread_group_auto_partition" && data.process_thread_group != PROCESS_THREAD_GROUP_SUB_THREAD) {
+		p_property.usage = 0;
+	}
 }
 
 void Node::input(const Ref<InputEvent> &p_event) {
@@ -3314,6 +3377,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
 
+	ClassDB::bind_method(D_METHOD("set_process_thread_group_auto_partition", "enable"), &Node::set_process_thread_group_auto_partition);
+	ClassDB::bind_method(D_METHOD("is_process_thread_group_auto_partition_enabled"), &Node::is_process_thread_group_auto_partition_enabled);
+
 	ClassDB::bind_method(D_METHOD("set_display_folded", "fold"), &Node::set_display_folded);
 	ClassDB::bind_method(D_METHOD("is_displayed_folded"), &Node::is_displayed_folded);
 
@@ -3495,6 +3561,7 @@ void Node::_bind_methods() {
 	ADD_SUBGROUP("Thread Group", "process_thread");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_thread_group_auto_partition"), "set_process_thread_group_auto_partition", "is_process_thread_group_auto_partition_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
 
 	ADD_GROUP("Editor Description", "editor_");
@@ -122,18 +122,6 @@ private:
 		SceneTree::Group *group = nullptr;
 	};
 
-	struct ComparatorByIndex {
-		bool operator()(const Node *p_left, const Node *p_right) const {
-			static const uint32_t order[3] = { 1, 0, 2 };
-			uint32_t order_left = order[p_left->data.internal_mode];
-			uint32_t order_right = order[p_right->data.internal_mode];
-			if (order_left == order_right) {
-				return p_left->data.index < p_right->data.index;
-			}
-			return order_left < order_right;
-		}
-	};
-
 	struct ComparatorWithPriority {
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.process_priority == p_a->data.process_priority ? p_b->is_greater_than(p_a) : p_b->data.process_priority > p_a->data.process_priority; }
 	};
@@ -151,7 +139,10 @@ private:
 		Node *parent = nullptr;
 		Node *owner = nullptr;
 		HashMap<StringName, Node *> children;
-		mutable bool children_cache_dirty = true;
+		// Children in order: internal front, external and internal back ones. Removing children leaves holes (nullptr),
+		// which are compacted the next time the order is needed. Until then, the counters below include the holes.
+		mutable bool children_cache_dirty = false;
+		mutable uint32_t children_cache_dirty_from = 0; // First hole.
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
@@ -159,7 +150,7 @@ private:
 		mutable int internal_children_front_count_cache = 0;
 		mutable int internal_children_back_count_cache = 0;
 		mutable int external_children_count_cache = 0;
-		mutable int index = -1; // relative to front, normal or back.
+		mutable int index = -1; // relative to front, normal or back. Also valid while the parent's cache is dirty.
 		int depth = -1;
 		int blocked = 0; // Safeguard that throws an error when attempting to modify the tree in a harmful way while being traversed.
 		StringName name;
@@ -183,6 +174,7 @@ private:
 		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
 		Node *process_thread_group_owner = nullptr;
 		int process_thread_group_order = 0;
+		bool process_thread_group_auto_partition = false;
 		BitField<ProcessThreadMessages> process_thread_messages;
 		void *process_group = nullptr; // to avoid cyclic dependency
 
@@ -199,6 +191,10 @@ private:
 		bool physics_process_internal = false;
 		bool process_internal = false;
 
+		// Internal processing done in batches, see SceneTree::register_process_batch().
+		int process_batch = -1;
+		uint32_t process_batch_index[2] = {}; // Position in the batch, indexed by physics.
+
 		bool input = false;
 		bool shortcut_input = false;
 		bool unhandled_input = false;
@@ -309,6 +305,10 @@ protected:
 
 	void _validate_property(PropertyInfo &p_property) const;
 
+	// Make the internal (physics) processing of this node happen in a batch, registered with
+	// SceneTree::register_process_batch(), instead of through notifications.
+	void set_process_batch(int p_batch);
+
 protected:
 	virtual void input(const Ref<InputEvent> &p_event);
 	virtual void shortcut_input(const Ref<InputEvent> &p_key_event);
@@ -524,6 +524,9 @@ public:
 	void set_process_thread_group_order(int p_order);
 	int get_process_thread_group_order() const;
 
+	void set_process_thread_group_auto_partition(bool p_enable);
+	bool is_process_thread_group_auto_partition_enabled() const;
+
 	void set_physics_process_priority(int p_priority);
 	int get_physics_process_priority() const;
 
@@ -542,6 +545,13 @@ public:
 	_FORCE_INLINE_ bool _is_any_processing() const {
 		return data.process || data.process_internal || data.physics_process || data.physics_process_internal;
 	}
+	_FORCE_INLINE_ bool _is_process_batched(bool p_physics) const {
+		if (data.process_batch < 0) {
+			return false;
+		}
+		// Nodes with a custom priority are processed one by one to keep their order.
+		return p_physics ? (data.physics_process_internal && data.physics_process_priority == 0) : (data.process_internal && data.process_priority == 0);
+	}
 	_FORCE_INLINE_ bool is_accessible_from_caller_thread() const {
 		if (current_process_thread_group == nullptr) {
 			// No thread processing.
@@ -39,6 +39,7 @@
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/frame_arena.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
@@ -119,6 +120,10 @@ SceneTreeTimer::SceneTreeTimer() {}
 
 void SceneTree::tree_changed() {
 	tree_version++;
+	if (tree_changed_deferred) {
+		tree_changed_pending = true;
+		return;
+	}
 	emit_signal(tree_changed_name);
 }
 
@@ -149,6 +154,11 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
+	if (!E->value.pending_removals.is_empty()) {
+		// The node may have been removed and is being added again (or another one reused its memory).
+		_erase_pending_removals(E->value.nodes, E->value.pending_removals);
+	}
+
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
 	E->value.nodes.push_back(p_node);
 	//E->value.last_tree_version=0;
@@ -162,12 +172,37 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	// Erasing from big groups one by one is slow, so do it when the group is needed again.
+	E->value.pending_removals.push_back(p_node);
+	if (E->value.pending_removals.size() == (uint32_t)E->value.nodes.size()) {
 		group_map.remove(E);
 	}
 }
 
+void SceneTree::_erase_pending_removals(Vector<Node *> &r_nodes, LocalVector<Node *> &r_pending_removals) {
+	if (r_pending_removals.size() == 1) {
+		r_nodes.erase(r_pending_removals[0]);
+	} else {
+		HashSet<Node *> removed;
+		removed.reserve(r_pending_removals.size());
+		for (Node *n : r_pending_removals) {
+			removed.insert(n);
+		}
+
+		// Single pass, keeping the order.
+		Node **nodes_ptr = r_nodes.ptrw();
+		int count = r_nodes.size();
+		int to = 0;
+		for (int i = 0; i < count; i++) {
+			if (!removed.has(nodes_ptr[i])) {
+				nodes_ptr[to++] = nodes_ptr[i];
+			}
+		}
+		r_nodes.resize(to);
+	}
+	r_pending_removals.clear();
+}
+
 void SceneTree::make_group_changed(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
@@ -210,6 +245,9 @@ void SceneTree::_flush_ugc() {
 }
 
 void SceneTree::_update_group_order(Group &g) {
+	if (!g.pending_removals.is_empty()) {
+		_erase_pending_removals(g.nodes, g.pending_removals);
+	}
 	if (!g.changed) {
 		return;
 	}
@@ -892,6 +930,75 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
+void SceneTree::_process_nodes(Node *const *p_nodes, uint32_t p_count, bool p_physics) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		Node *n = p_nodes[i];
+		if (nodes_removed_on_group_call.has(n)) {
+			// Node may have been removed during process, skip it.
+			// Keep in mind removals can only happen on the main thread.
+			continue;
+		}
+
+		if (!n->can_process() || !n->is_inside_tree()) {
+			continue;
+		}
+
+		if (p_physics) {
+			if (n->is_physics_processing_internal() && !n->_is_process_batched(true)) {
+				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+			}
+			if (n->is_physics_processing()) {
+				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+			}
+		} else {
+			if (n->is_processing_internal() && !n->_is_process_batched(false)) {
+				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+			}
+			if (n->is_processing()) {
+				n->notification(Node::NOTIFICATION_PROCESS);
+			}
+		}
+	}
+}
+
+void SceneTree::_process_batches(ProcessGroup *p_group, bool p_physics) {
+	LocalVector<LocalVector<Node *>> &batches = p_group->batches[p_physics];
+	LocalVector<Node *> &batch_nodes = p_group->batch_nodes_cache;
+
+	for (uint32_t i = 0; i < batches.size(); i++) {
+		if (batches[i].is_empty()) {
+			continue;
+		}
+
+		// Make a copy with the nodes that can process, so batches don't need to check and nodes can stop processing meanwhile.
+		batch_nodes.clear();
+		for (Node *n : batches[i]) {
+			if (nodes_removed_on_group_call.has(n) || !n->can_process() || !n->is_inside_tree()) {
+				continue;
+			}
+			batch_nodes.push_back(n);
+		}
+
+		if (!batch_nodes.is_empty()) {
+			process_batch_callbacks[i](batch_nodes.ptr(), batch_nodes.size(), p_physics);
+		}
+	}
+}
+
+void SceneTree::_process_nodes_and_batches(ProcessGroup *p_group, Node *const *p_nodes, uint32_t p_count, bool p_physics) {
+	// Batched nodes have the default priority, so process them right before the first node that also has it (or a greater one).
+	uint32_t split = 0;
+	while (split < p_count && (p_physics ? p_nodes[split]->data.physics_process_priority : p_nodes[split]->data.process_priority) < 0) {
+		split++;
+	}
+
+	_process_nodes(p_nodes, split, p_physics);
+	if (p_group->batched_node_count[p_physics] > 0) {
+		_process_batches(p_group, p_physics);
+	}
+	_process_nodes(p_nodes + split, p_count - split, p_physics);
+}
+
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
@@ -899,7 +1006,15 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	p_group->call_queue.flush(); // Flush messages before processing.
 
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
-	if (nodes.is_empty()) {
+	if (!p_group->pending_removals[p_physics].is_empty()) {
+		_erase_pending_removals(nodes, p_group->pending_removals[p_physics]);
+	}
+	if (nodes.is_empty() && p_group->batched_node_count[p_physics] == 0) {
+		if (p_group->partitioned) {
+			p_group->partitions[p_physics].clear();
+			p_group->partition_stage_ends[p_physics].clear();
+			p_group->partitions_dirty[p_physics] = false;
+		}
 		return;
 	}
 
@@ -907,56 +1022,223 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 		if (p_group->physics_node_order_dirty) {
 			nodes.sort_custom<Node::ComparatorWithPhysicsPriority>();
 			p_group->physics_node_order_dirty = false;
+			p_group->partitions_dirty[1] = true;
 		}
 	} else {
 		if (p_group->node_order_dirty) {
 			nodes.sort_custom<Node::ComparatorWithPriority>();
 			p_group->node_order_dirty = false;
+			p_group->partitions_dirty[0] = true;
+		}
+	}
+
+	if (p_group->partitioned) {
+		// Only prepare the partitions. They are processed afterwards, and messages are flushed once
+		// all of them are done.
+		if (p_group->partitions_dirty[p_physics]) {
+			_update_group_partitions(p_group, p_physics);
 		}
+		return;
 	}
 
+	// Partitions may be outdated the next time they are used.
+	p_group->partitions_dirty[p_physics] = true;
+
 	// Make a copy, so if nodes are added/removed from process, this does not break
 	Vector<Node *> nodes_copy = nodes;
 
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+	_process_nodes_and_batches(p_group, nodes_copy.ptr(), nodes_copy.size(), p_physics);
 
-	for (uint32_t i = 0; i < node_count; i++) {
-		Node *n = nodes_ptr[i];
-		if (nodes_removed_on_group_call.has(n)) {
-			// Node may have been removed during process, skip it.
-			// Keep in mind removals can only happen on the main thread.
-			continue;
+	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+}
+
+void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
+	ProcessGroup *pg = local_process_group_cache[p_index];
+	uint64_t from = OS::get_singleton()->get_ticks_usec();
+
+	Node::current_process_thread_group = pg->owner;
+	_process_group(pg, p_physics);
+	Node::current_process_thread_group = nullptr;
+
+	pg->process_usec.add(OS::get_singleton()->get_ticks_usec() - from);
+}
+
+void SceneTree::_update_group_partitions(ProcessGroup *p_group, bool p_physics) {
+	// Nodes never change the partition they belong to while the group is being processed, as this
+	// requires them to exit the tree (which can only happen on the main thread, between passes).
+	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
+	LocalVector<ProcessGroup::Partition> &partitions = p_group->partitions[p_physics];
+	LocalVector<uint32_t> &stage_ends = p_group->partition_stage_ends[p_physics];
+
+	// Keep the measured cost of partitions that still exist.
+	HashMap<ObjectID, uint64_t> previous_costs;
+	for (const ProcessGroup::Partition &partition : partitions) {
+		if (partition.root) {
+			previous_costs[partition.root->get_instance_id()] = partition.cost;
 		}
+	}
 
-		if (!n->can_process() || !n->is_inside_tree()) {
-			continue;
+	partitions.clear();
+	stage_ends.clear();
+
+	// Find the child of the owner each node is under.
+	LocalVector<Node *> roots;
+	roots.resize(nodes.size());
+	HashMap<StringName, uint32_t> class_count;
+	HashSet<Node *> counted_roots;
+	for (int i = 0; i < nodes.size(); i++) {
+		Node *root = nodes[i];
+		while (root && root->data.parent != p_group->owner) {
+			root = root->data.parent;
 		}
+		roots[i] = root;
+		if (root && !counted_roots.has(root)) {
+			counted_roots.insert(root);
+			class_count[root->get_class_name()]++;
+		}
+	}
 
-		if (p_physics) {
-			if (n->is_physics_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+	// Batches run right before the first node with the default priority (or a greater one), like in _process_nodes_and_batches().
+	uint32_t batch_split = nodes.size();
+	if (p_group->batched_node_count[p_physics] > 0) {
+		batch_split = 0;
+		while (batch_split < (uint32_t)nodes.size() && (p_physics ? nodes[batch_split]->data.physics_process_priority : nodes[batch_split]->data.process_priority) < 0) {
+			batch_split++;
+		}
+	}
+
+	// Only siblings sharing their class with others are partitioned. Consecutive runs of partitioned nodes
+	// form a stage, and every run of nodes in between forms a stage of its own which is processed in order.
+	HashMap<Node *, uint32_t> partition_indices;
+	bool in_parallel_stage = false;
+	for (uint32_t i = 0; i <= (uint32_t)nodes.size(); i++) {
+		if (i == batch_split) {
+			// Batches always start an in-order stage.
+			if (!partitions.is_empty()) {
+				stage_ends.push_back(partitions.size());
 			}
-			if (n->is_physics_processing()) {
-				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+			partitions.resize(partitions.size() + 1);
+			partitions[partitions.size() - 1].batches = true;
+			partition_indices.clear();
+			in_parallel_stage = false;
+		}
+		if (i == (uint32_t)nodes.size()) {
+			break;
+		}
+
+		Node *root = roots[i];
+		bool parallel = root && class_count[root->get_class_name()] >= 2;
+		if (partitions.is_empty() || parallel != in_parallel_stage) {
+			// Start a new stage.
+			if (!partitions.is_empty()) {
+				stage_ends.push_back(partitions.size());
 			}
-		} else {
-			if (n->is_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+			partition_indices.clear();
+			in_parallel_stage = parallel;
+			if (!parallel) {
+				partitions.resize(partitions.size() + 1);
 			}
-			if (n->is_processing()) {
-				n->notification(Node::NOTIFICATION_PROCESS);
+		}
+
+		if (!parallel) {
+			partitions[partitions.size() - 1].nodes.push_back(nodes[i]);
+			continue;
+		}
+
+		HashMap<Node *, uint32_t>::Iterator E = partition_indices.find(root);
+		if (!E) {
+			E = partition_indices.insert(root, partitions.size());
+			partitions.resize(partitions.size() + 1);
+			ProcessGroup::Partition &partition = partitions[partitions.size() - 1];
+			partition.root = root;
+			HashMap<ObjectID, uint64_t>::ConstIterator C = previous_costs.find(root->get_instance_id());
+			if (C) {
+				partition.cost = C->value;
 			}
 		}
+		partitions[E->value].nodes.push_back(nodes[i]);
+	}
+	if (!partitions.is_empty()) {
+		stage_ends.push_back(partitions.size());
 	}
 
-	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+	p_group->partitions_dirty[p_physics] = false;
 }
 
-void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+void SceneTree::_balance_group_partitions(ProcessGroup *p_group, bool p_physics, uint32_t p_stage) {
+	LocalVector<ProcessGroup::Partition> &partitions = p_group->partitions[p_physics];
+	const LocalVector<uint32_t> &stage_ends = p_group->partition_stage_ends[p_physics];
+	if (p_stage >= stage_ends.size()) {
+		return;
+	}
+	uint32_t stage_begin = p_stage > 0 ? stage_ends[p_stage - 1] : 0;
+	uint32_t stage_size = stage_ends[p_stage] - stage_begin;
+
+	struct PartitionCost {
+		uint64_t cost = 0;
+		uint32_t index = 0;
+		// Most expensive first.
+		bool operator<(const PartitionCost &p_other) const { return cost > p_other.cost; }
+	};
+
+	FrameLocalVector<PartitionCost> costs;
+	costs.resize(stage_size);
+	for (uint32_t i = 0; i < stage_size; i++) {
+		costs[i].cost = partitions[stage_begin + i].cost;
+		costs[i].index = stage_begin + i;
+	}
+	costs.sort();
+
+	// Assign each partition to the least loaded bucket, starting by the most expensive.
+	uint32_t bucket_count = MIN(stage_size, WorkerThreadPool::get_singleton()->get_parallel_slot_count());
+	p_group->partition_buckets.resize(bucket_count);
+	FrameLocalVector<uint64_t> loads;
+	loads.resize(bucket_count);
+	for (uint32_t i = 0; i < bucket_count; i++) {
+		p_group->partition_buckets[i].clear();
+		loads[i] = 0;
+	}
+
+	for (const PartitionCost &E : costs) {
+		uint32_t best = 0;
+		for (uint32_t i = 1; i < bucket_count; i++) {
+			if (loads[i] < loads[best]) {
+				best = i;
+			}
+		}
+		p_group->partition_buckets[best].push_back(E.index);
+		loads[best] += E.cost;
+	}
+
+	for (uint32_t i = 0; i < bucket_count; i++) {
+		PartitionTask task;
+		task.group = p_group;
+		task.bucket = i;
+		local_partition_task_cache.push_back(task);
+	}
+}
+
+void SceneTree::_process_partitions_thread(uint32_t p_index, bool p_physics) {
+	const PartitionTask &task = local_partition_task_cache[p_index];
+	ProcessGroup *pg = task.group;
+	LocalVector<ProcessGroup::Partition> &partitions = pg->partitions[p_physics];
+	uint64_t total = 0;
+
+	Node::current_process_thread_group = pg->owner;
+	for (uint32_t index : pg->partition_buckets[task.bucket]) {
+		ProcessGroup::Partition &partition = partitions[index];
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		if (partition.batches && pg->batched_node_count[p_physics] > 0) {
+			_process_batches(pg, p_physics);
+		}
+		_process_nodes(partition.nodes.ptr(), partition.nodes.size(), p_physics);
+		uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - from;
+		partition.cost = MAX(uint64_t(1), (partition.cost * 3 + elapsed) / 4);
+		total += elapsed;
+	}
 	Node::current_process_thread_group = nullptr;
+
+	pg->process_usec.add(total);
 }
 
 void SceneTree::_process(bool p_physics) {
@@ -1017,12 +1299,18 @@ void SceneTree::_process(bool p_physics) {
 				if (using_threads) {
 					local_process_group_cache.clear();
 				}
+				bool any_partitioned = false;
 				for (uint32_t j = from; j < i; j++) {
-					if (process_groups[j]->last_pass == process_last_pass) {
+					ProcessGroup *pg = process_groups[j];
+					pg->partitioned = false;
+					if (pg->last_pass == process_last_pass) {
 						if (using_threads) {
-							local_process_group_cache.push_back(process_groups[j]);
+							pg->partitioned = pg->owner->data.process_thread_group_auto_partition;
+							any_partitioned = any_partitioned || pg->partitioned;
+							pg->process_usec.set(0);
+							local_process_group_cache.push_back(pg);
 						} else {
-							_process_group(process_groups[j], p_physics);
+							_process_group(pg, p_physics);
 						}
 					}
 				}
@@ -1031,6 +1319,45 @@ void SceneTree::_process(bool p_physics) {
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 				}
+
+				if (any_partitioned) {
+					// Process the partitions of all groups together, one stage at a time, then flush their messages.
+					for (uint32_t stage = 0;; stage++) {
+						local_partition_task_cache.clear();
+						for (ProcessGroup *pg : local_process_group_cache) {
+							if (pg->partitioned) {
+								_balance_group_partitions(pg, p_physics, stage);
+							}
+						}
+						if (local_partition_task_cache.is_empty()) {
+							break;
+						}
+
+						WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_partitions_thread, p_physics, local_partition_task_cache.size(), -1, true);
+						WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					}
+
+					for (ProcessGroup *pg : local_process_group_cache) {
+						if (pg->partitioned) {
+							Node::current_process_thread_group = pg->owner;
+							pg->call_queue.flush();
+							Node::current_process_thread_group = nullptr;
+						}
+					}
+				}
+
+#ifdef DEBUG_ENABLED
+				if (using_threads && EngineDebugger::is_profiling("servers")) {
+					// Time spent by each thread group, added on all the threads it used.
+					for (const ProcessGroup *pg : local_process_group_cache) {
+						Array values;
+						values.push_back(p_physics ? "physics_process_thread_groups" : "process_thread_groups");
+						values.push_back(String(pg->owner->get_name()));
+						values.push_back(USEC_TO_SEC(pg->process_usec.get()));
+						EngineDebugger::profiler_add_frame_data("servers", values);
+					}
+				}
+#endif
 			}
 
 			if (i == group_count) {
@@ -1052,13 +1379,13 @@ void SceneTree::_process(bool p_physics) {
 		// Validate group for processing
 		bool process_valid = false;
 		if (p_physics) {
-			if (!pg->physics_nodes.is_empty()) {
+			if (!pg->physics_nodes.is_empty() || pg->batched_node_count[1] > 0) {
 				process_valid = true;
 			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES_PHYSICS))) && pg->call_queue.has_messages()) {
 				process_valid = true;
 			}
 		} else {
-			if (!pg->nodes.is_empty()) {
+			if (!pg->nodes.is_empty() || pg->batched_node_count[0] > 0) {
 				process_valid = true;
 			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES))) && pg->call_queue.has_messages()) {
 				process_valid = true;
@@ -1119,14 +1446,22 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
-	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+	bool batched = p_node->_is_process_batched(false);
+	if (batched) {
+		_remove_node_from_process_batch(pg, p_node, false);
+	}
+	if (p_node->is_processing() || (p_node->is_processing_internal() && !batched)) {
+		pg->pending_removals[0].push_back(p_node);
+		pg->partitions_dirty[0] = true;
 	}
 
-	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+	bool physics_batched = p_node->_is_process_batched(true);
+	if (physics_batched) {
+		_remove_node_from_process_batch(pg, p_node, true);
+	}
+	if (p_node->is_physics_processing() || (p_node->is_physics_processing_internal() && !physics_batched)) {
+		pg->pending_removals[1].push_back(p_node);
+		pg->partitions_dirty[1] = true;
 	}
 }
 
@@ -1134,17 +1469,62 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
-	if (p_node->is_processing() || p_node->is_processing_internal()) {
+	bool batched = p_node->_is_process_batched(false);
+	if (batched) {
+		_add_node_to_process_batch(pg, p_node, false);
+	}
+	if (p_node->is_processing() || (p_node->is_processing_internal() && !batched)) {
+		if (!pg->pending_removals[0].is_empty()) {
+			_erase_pending_removals(pg->nodes, pg->pending_removals[0]);
+		}
 		pg->nodes.push_back(p_node);
 		pg->node_order_dirty = true;
 	}
 
-	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+	bool physics_batched = p_node->_is_process_batched(true);
+	if (physics_batched) {
+		_add_node_to_process_batch(pg, p_node, true);
+	}
+	if (p_node->is_physics_processing() || (p_node->is_physics_processing_internal() && !physics_batched)) {
+		if (!pg->pending_removals[1].is_empty()) {
+			_erase_pending_removals(pg->physics_nodes, pg->pending_removals[1]);
+		}
 		pg->physics_nodes.push_back(p_node);
 		pg->physics_node_order_dirty = true;
 	}
 }
 
+void SceneTree::_add_node_to_process_batch(ProcessGroup *p_group, Node *p_node, bool p_physics) {
+	int batch = p_node->data.process_batch;
+	ERR_FAIL_INDEX(batch, process_batch_count);
+
+	LocalVector<LocalVector<Node *>> &batches = p_group->batches[p_physics];
+	if (batches.size() <= uint32_t(batch)) {
+		batches.resize(batch + 1);
+	}
+
+	p_node->data.process_batch_index[p_physics] = batches[batch].size();
+	batches[batch].push_back(p_node);
+	p_group->batched_node_count[p_physics]++;
+}
+
+void SceneTree::_remove_node_from_process_batch(ProcessGroup *p_group, Node *p_node, bool p_physics) {
+	int batch = p_node->data.process_batch;
+	LocalVector<LocalVector<Node *>> &batches = p_group->batches[p_physics];
+	ERR_FAIL_UNSIGNED_INDEX(uint32_t(batch), batches.size());
+
+	// Order doesn't matter within batches, so replace with the last one.
+	LocalVector<Node *> &nodes = batches[batch];
+	uint32_t index = p_node->data.process_batch_index[p_physics];
+	ERR_FAIL_COND(index >= nodes.size() || nodes[index] != p_node);
+
+	Node *last = nodes[nodes.size() - 1];
+	nodes[index] = last;
+	last->data.process_batch_index[p_physics] = index;
+	nodes.resize(nodes.size() - 1);
+	p_group->batched_node_count[p_physics]--;
+}
+
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	Vector<Node *> nodes_copy;
 	{
@@ -1336,6 +1716,15 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
 
+	if (delete_queue.is_empty()) {
+		return;
+	}
+
+	// Removals from groups and process lists are already deferred until they are needed again,
+	// so only the tree change signal (emitted by every node) is left to coalesce.
+	bool was_deferred = tree_changed_deferred;
+	tree_changed_deferred = true;
+
 	while (delete_queue.size()) {
 		Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
 		if (obj) {
@@ -1343,6 +1732,12 @@ void SceneTree::_flush_delete_queue() {
 		}
 		delete_queue.pop_front();
 	}
+
+	tree_changed_deferred = was_deferred;
+	if (!tree_changed_deferred && tree_changed_pending) {
+		tree_changed_pending = false;
+		emit_signal(tree_changed_name);
+	}
 }
 
 void SceneTree::queue_delete(Object *p_object) {
@@ -1649,6 +2044,16 @@ void SceneTree::add_idle_callback(IdleCallback p_callback) {
 	idle_callbacks[idle_callback_count++] = p_callback;
 }
 
+SceneTree::ProcessBatchCallback SceneTree::process_batch_callbacks[SceneTree::MAX_PROCESS_BATCHES];
+int SceneTree::process_batch_count = 0;
+
+int SceneTree::register_process_batch(ProcessBatchCallback p_callback) {
+	ERR_FAIL_NULL_V(p_callback, -1);
+	ERR_FAIL_COND_V(process_batch_count >= MAX_PROCESS_BATCHES, -1);
+	process_batch_callbacks[process_batch_count] = p_callback;
+	return process_batch_count++;
+}
+
 void SceneTree::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 	if (p_function == "change_scene_to_file") {
 		Ref<DirAccess> dir_access = DirAccess::create(DirAccess::ACCESS_RESOURCES);
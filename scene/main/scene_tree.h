@@ -85,6 +85,7 @@ class SceneTree : public MainLoop {
 
 public:
 	typedef void (*IdleCallback)();
+	typedef void (*ProcessBatchCallback)(Node *const *p_nodes, uint32_t p_count, bool p_physics);
 
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
@@ -98,6 +99,32 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		SafeNumeric<uint64_t> process_usec; // Time spent processing in the last pass (on all threads).
+		LocalVector<Node *> pending_removals[2]; // Erased all at once before processing or adding nodes. Indexed by p_physics.
+
+		// Used when the owner enables automatic partitioning. Indexed by p_physics.
+		// Partitions are split in stages which run one after another, so process order is kept between them.
+		struct Partition {
+			Node *root = nullptr; // Child of the owner, or null for nodes that must run in order (and batches, if any).
+			LocalVector<Node *> nodes;
+			uint64_t cost = 1; // Smoothed processing time, in usec.
+			bool batches = false; // Whether the batches run before the nodes.
+		};
+		bool partitioned = false; // Whether this pass processes the partitions separately.
+		bool partitions_dirty[2] = { true, true };
+		LocalVector<Partition> partitions[2];
+		LocalVector<uint32_t> partition_stage_ends[2]; // Index past the last partition of each stage.
+		LocalVector<LocalVector<uint32_t>> partition_buckets; // Indices of the partitions each thread processes.
+
+		// Nodes whose internal processing happens in batches. Indexed by p_physics, then by batch.
+		LocalVector<LocalVector<Node *>> batches[2];
+		uint32_t batched_node_count[2] = {};
+		LocalVector<Node *> batch_nodes_cache;
+	};
+
+	struct PartitionTask {
+		ProcessGroup *group = nullptr;
+		uint32_t bucket = 0;
 	};
 
 	struct ProcessGroupSort {
@@ -109,6 +136,7 @@ private:
 	LocalVector<ProcessGroup *> process_groups;
 	bool process_groups_dirty = true;
 	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	LocalVector<PartitionTask> local_partition_task_cache;
 	uint64_t process_last_pass = 1;
 
 	ProcessGroup default_process_group;
@@ -117,6 +145,7 @@ private:
 
 	struct Group {
 		Vector<Node *> nodes;
+		LocalVector<Node *> pending_removals; // Erased all at once before the group is accessed again.
 		bool changed = false;
 	};
 
@@ -174,6 +203,11 @@ private:
 	void _flush_ugc();
 
 	_FORCE_INLINE_ void _update_group_order(Group &g);
+	void _erase_pending_removals(Vector<Node *> &r_nodes, LocalVector<Node *> &r_pending_removals);
+
+	// Signals about tree changes are emitted once when flushing the delete queue.
+	bool tree_changed_deferred = false;
+	bool tree_changed_pending = false;
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -215,8 +249,16 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
+	void _process_nodes(Node *const *p_nodes, uint32_t p_count, bool p_physics);
+	void _process_batches(ProcessGroup *p_group, bool p_physics);
+	void _process_nodes_and_batches(ProcessGroup *p_group, Node *const *p_nodes, uint32_t p_count, bool p_physics);
+	void _add_node_to_process_batch(ProcessGroup *p_group, Node *p_node, bool p_physics);
+	void _remove_node_from_process_batch(ProcessGroup *p_group, Node *p_node, bool p_physics);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _update_group_partitions(ProcessGroup *p_group, bool p_physics);
+	void _balance_group_partitions(ProcessGroup *p_group, bool p_physics, uint32_t p_stage);
+	void _process_partitions_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -247,6 +289,13 @@ private:
 	static int idle_callback_count;
 	void _call_idle_callbacks();
 
+	enum {
+		MAX_PROCESS_BATCHES = 64
+	};
+
+	static ProcessBatchCallback process_batch_callbacks[MAX_PROCESS_BATCHES];
+	static int process_batch_count;
+
 	void _main_window_focus_in();
 	void _main_window_close();
 	void _main_window_go_back();
@@ -418,6 +467,9 @@ public:
 	bool is_multiplayer_poll_enabled() const;
 
 	static void add_idle_callback(IdleCallback p_callback);
+	// Nodes using the returned batch (see Node::set_process_batch()) receive their internal processing through a single
+	// call per frame and process group, instead of a notification each. Must be called on startup (like when binding methods).
+	static int register_process_batch(ProcessBatchCallback p_callback);
 
 	void set_disable_node_threading(bool p_disable);
 	//default texture settings
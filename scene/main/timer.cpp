@@ -32,6 +32,12 @@
 
 void Timer::_notification(int p_what) {
 	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE: {
+			// Scripts extending Timer may rely on receiving the internal process notifications, so only
+			// native timers are processed in batches.
+			set_process_batch(get_script_instance() ? -1 : process_batch);
+		} break;
+
 		case NOTIFICATION_READY: {
 			if (autostart) {
 #ifdef TOOLS_ENABLED
@@ -44,19 +50,12 @@ void Timer::_notification(int p_what) {
 			}
 		} break;
 
+		// Only received when processing with a custom priority or with a script, otherwise timers are processed in batches.
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (!processing || timer_process_callback == TIMER_PROCESS_PHYSICS || !is_processing_internal()) {
 				return;
 			}
-			time_left -= get_process_delta_time();
-
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-
+			if (_advance(get_process_delta_time())) {
 				emit_signal(SNAME("timeout"));
 			}
 		} break;
@@ -65,20 +64,63 @@ void Timer::_notification(int p_what) {
 			if (!processing || timer_process_callback == TIMER_PROCESS_IDLE || !is_physics_processing_internal()) {
 				return;
 			}
-			time_left -= get_physics_process_delta_time();
-
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
+			if (_advance(get_physics_process_delta_time())) {
 				emit_signal(SNAME("timeout"));
 			}
 		} break;
 	}
 }
 
+bool Timer::_advance(double p_delta) {
+	time_left -= p_delta;
+
+	if (time_left < 0) {
+		if (!one_shot) {
+			time_left += wait_time;
+		} else {
+			stop();
+		}
+		return true;
+	}
+	return false;
+}
+
+int Timer::process_batch = -1;
+
+void Timer::_process_batch(Node *const *p_nodes, uint32_t p_count, bool p_physics) {
+	const double delta = p_physics ? p_nodes[0]->get_physics_process_delta_time() : p_nodes[0]->get_process_delta_time();
+	const TimerProcessCallback callback = p_physics ? TIMER_PROCESS_PHYSICS : TIMER_PROCESS_IDLE;
+
+	// Emitting the signal may run any code (including freeing other timers in this batch),
+	// so first advance all timers, then emit the signals.
+	struct TimedOut {
+		ObjectID id;
+		bool stopped = false; // One-shot timers stop themselves when timing out.
+	};
+	LocalVector<TimedOut> timed_out;
+	for (uint32_t i = 0; i < p_count; i++) {
+		Timer *timer = static_cast<Timer *>(p_nodes[i]);
+		if (!timer->processing || timer->timer_process_callback != callback) {
+			continue;
+		}
+		if (timer->_advance(delta)) {
+			timed_out.push_back({ timer->get_instance_id(), !timer->processing });
+		}
+	}
+
+	for (const TimedOut &E : timed_out) {
+		Timer *timer = Object::cast_to<Timer>(ObjectDB::get_instance(E.id));
+		if (!timer || !timer->is_inside_tree()) {
+			continue;
+		}
+		// A previous timeout may have stopped or paused this timer, or changed how it processes.
+		if (!E.stopped && (!timer->processing || timer->paused || timer->is_stopped() || timer->timer_process_callback != callback)) {
+			continue;
+		}
+		timer->emit_signal(SNAME("timeout"));
+	}
+}
+
 void Timer::set_wait_time(double p_time) {
 	ERR_FAIL_COND_MSG(p_time <= 0, "Time should be greater than zero.");
 	wait_time = p_time;
@@ -191,6 +233,8 @@ PackedStringArray Timer::get_configuration_warnings() const {
 }
 
 void Timer::_bind_methods() {
+	process_batch = SceneTree::register_process_batch(&Timer::_process_batch);
+
 	ClassDB::bind_method(D_METHOD("set_wait_time", "time_sec"), &Timer::set_wait_time);
 	ClassDB::bind_method(D_METHOD("get_wait_time"), &Timer::get_wait_time);
 
@@ -226,4 +270,6 @@ void Timer::_bind_methods() {
 	BIND_ENUM_CONSTANT(TIMER_PROCESS_IDLE);
 }
 
-Timer::Timer() {}
+Timer::Timer() {
+	set_process_batch(process_batch);
+}
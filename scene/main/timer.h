@@ -44,6 +44,10 @@ class Timer : public Node {
 
 	double time_left = -1.0;
 
+	static int process_batch;
+	static void _process_batch(Node *const *p_nodes, uint32_t p_count, bool p_physics);
+	bool _advance(double p_delta);
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
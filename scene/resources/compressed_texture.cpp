@@ -297,6 +297,8 @@ void CompressedTexture2D::_validate_property(PropertyInfo &p_property) const {
 }
 
 Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_size_limit) {
+	Memory::TagScope tag_scope(Memory::TAG_TEXTURE);
+
 	uint32_t data_format = f->get_32();
 	uint32_t w = f->get_16();
 	uint32_t h = f->get_16();
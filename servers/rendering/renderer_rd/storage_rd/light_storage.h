@@ -31,6 +31,7 @@
 #ifndef LIGHT_STORAGE_RD_H
 #define LIGHT_STORAGE_RD_H
 
+#include "core/templates/flat_hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_array.h"
 #include "core/templates/rid_owner.h"
@@ -400,7 +401,7 @@ private:
 		RID depth;
 		RID fb; //for copying
 
-		HashMap<RID, uint32_t> shadow_owners;
+		FlatHashMap<RID, uint32_t> shadow_owners;
 	};
 
 	RID_Owner<ShadowAtlas> shadow_atlas_owner;
@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*  test_math_simd.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MATH_SIMD_H
+#define TEST_MATH_SIMD_H
+
+#include "core/math/math_simd.h"
+#include "core/math/transform_3d.h"
+#include "core/variant/variant.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestMathSIMD {
+
+// Sizes around the 4 and 12 component blocks, to cover the vector loops and the scalar tails.
+static const int test_sizes[] = { 1, 3, 4, 5, 11, 12, 13, 24, 37, 100 };
+
+static float test_value(int p_index) {
+	return float((p_index * 7919) % 201 - 100) * 0.125f;
+}
+
+TEST_CASE("[MathSIMD] Repeated values match scalar loops") {
+	const float value[3] = { 1.5f, -2.0f, 0.25f };
+	const float lo[3] = { -4.0f, -1.0f, 0.0f };
+	const float hi[3] = { 4.0f, 1.0f, 2.0f };
+	for (int width = 1; width <= 3; width++) {
+		for (int size : test_sizes) {
+			const int count = size * width;
+			Vector<float> added, multiplied, clamped;
+			added.resize(count);
+			multiplied.resize(count);
+			clamped.resize(count);
+			for (int i = 0; i < count; i++) {
+				added.write[i] = test_value(i);
+				multiplied.write[i] = test_value(i);
+				clamped.write[i] = test_value(i);
+			}
+			MathSIMD::add(added.ptrw(), count, value, width);
+			MathSIMD::multiply(multiplied.ptrw(), count, value, width);
+			MathSIMD::clamp(clamped.ptrw(), count, lo, hi, width);
+			for (int i = 0; i < count; i++) {
+				CHECK(added[i] == test_value(i) + value[i % width]);
+				CHECK(multiplied[i] == test_value(i) * value[i % width]);
+				CHECK(clamped[i] == CLAMP(test_value(i), lo[i % width], hi[i % width]));
+			}
+		}
+	}
+}
+
+TEST_CASE("[MathSIMD] Reductions match scalar loops") {
+	for (int width = 1; width <= 3; width++) {
+		for (int size : test_sizes) {
+			const int count = size * width;
+			Vector<float> data;
+			data.resize(count);
+			for (int i = 0; i < count; i++) {
+				data.write[i] = test_value(i);
+			}
+			float sum[3], min[3], max[3];
+			MathSIMD::sum(data.ptr(), count, width, sum);
+			MathSIMD::min(data.ptr(), count, width, min);
+			MathSIMD::max(data.ptr(), count, width, max);
+			for (int j = 0; j < width; j++) {
+				float expected_sum = 0;
+				float expected_min = data[j];
+				float expected_max = data[j];
+				for (int i = j; i < count; i += width) {
+					expected_sum += data[i];
+					expected_min = MIN(expected_min, data[i]);
+					expected_max = MAX(expected_max, data[i]);
+				}
+				// The test values are multiples of 1/8, so the sums are exact in any order.
+				CHECK(sum[j] == expected_sum);
+				CHECK(min[j] == expected_min);
+				CHECK(max[j] == expected_max);
+			}
+		}
+	}
+}
+
+TEST_CASE("[MathSIMD] Array operations match scalar loops") {
+	for (int size : test_sizes) {
+		Vector<float> a, b, prefix;
+		a.resize(size);
+		b.resize(size);
+		for (int i = 0; i < size; i++) {
+			a.write[i] = test_value(i);
+			b.write[i] = test_value(i + 31);
+		}
+		Vector<float> added = a.duplicate();
+		Vector<float> multiplied = a.duplicate();
+		Vector<float> lerped = a.duplicate();
+		prefix = a.duplicate();
+		MathSIMD::add_array(added.ptrw(), b.ptr(), size);
+		MathSIMD::multiply_array(multiplied.ptrw(), b.ptr(), size);
+		MathSIMD::lerp_array(lerped.ptrw(), b.ptr(), size, 0.5f);
+		MathSIMD::prefix_sum(prefix.ptrw(), size);
+		float dot = 0;
+		float running = 0;
+		for (int i = 0; i < size; i++) {
+			CHECK(added[i] == a[i] + b[i]);
+			CHECK(multiplied[i] == a[i] * b[i]);
+			CHECK(lerped[i] == a[i] + (b[i] - a[i]) * 0.5f);
+			running += a[i];
+			CHECK(prefix[i] == running);
+			dot += a[i] * b[i];
+		}
+		CHECK(MathSIMD::dot(a.ptr(), b.ptr(), size) == doctest::Approx(dot));
+	}
+}
+
+TEST_CASE("[MathSIMD] Transform matches Transform3D::xform") {
+	const Transform3D xform(Basis(Vector3(0, 1, 0), Math_PI / 3).scaled(Vector3(2, 3, 0.5)), Vector3(1, -2, 3));
+	for (int size : test_sizes) {
+		Vector<Vector3> points;
+		points.resize(size);
+		for (int i = 0; i < size; i++) {
+			points.write[i] = Vector3(test_value(i), test_value(i + 1), test_value(i + 2));
+		}
+		Vector<Vector3> in_place = points.duplicate();
+		Vector3 *w = in_place.ptrw();
+		MathSIMD::transform(w, w, size, xform);
+		for (int i = 0; i < size; i++) {
+			CHECK(in_place[i].is_equal_approx(xform.xform(points[i])));
+		}
+	}
+}
+
+TEST_CASE("[MathSIMD] Packed array methods") {
+	PackedVector3Array points;
+	points.push_back(Vector3(1, 5, -3));
+	points.push_back(Vector3(-2, 0, 4));
+	Variant array = points;
+
+	CHECK(Vector3(array.call("min")) == Vector3(-2, 0, -3));
+	CHECK(Vector3(array.call("max")) == Vector3(1, 5, 4));
+	CHECK(Vector3(array.call("sum")) == Vector3(-1, 5, 1));
+
+	array.call("add", Vector3(1, 1, 1));
+	CHECK(PackedVector3Array(array)[1] == Vector3(-1, 1, 5));
+	array.call("transform", Transform3D(Basis(), Vector3(0, 0, 10)));
+	CHECK(PackedVector3Array(array)[0] == Vector3(2, 6, 8));
+
+	PackedFloat32Array values;
+	values.push_back(1);
+	values.push_back(2);
+	values.push_back(3);
+	Variant float_array = values;
+	CHECK(double(float_array.call("dot", values)) == 14);
+	float_array.call("prefix_sum");
+	CHECK(PackedFloat32Array(float_array)[2] == 6);
+	CHECK(double(Variant(PackedFloat32Array()).call("sum")) == 0);
+}
+
+} // namespace TestMathSIMD
+
+#endif // TEST_MATH_SIMD_H
@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+static LocalVector<int> last_seen;
+static int calls = 0;
+static bool order_broken = false;
+
+static void record_call(int p_producer, int p_sequence) {
+	// Only called when flushing, so no need for thread safety here.
+	if (last_seen[p_producer] + 1 != p_sequence) {
+		order_broken = true;
+	}
+	last_seen[p_producer] = p_sequence;
+	calls++;
+}
+
+struct ProducerData {
+	CallQueue *queue = nullptr;
+	int producer = 0;
+	int count = 0;
+};
+
+static void producer_function(void *p_user) {
+	ProducerData *data = (ProducerData *)p_user;
+	for (int i = 1; i <= data->count; i++) {
+		data->queue->push_callable(callable_mp_static(&record_call), data->producer, i);
+	}
+}
+
+TEST_CASE("[CallQueue] Calls pushed from several threads are flushed once and in order per thread") {
+	const int producer_count = 4;
+	const int count = 20000;
+
+	CallQueue queue;
+
+	last_seen.clear();
+	last_seen.resize(producer_count);
+	for (int i = 0; i < producer_count; i++) {
+		last_seen[i] = 0;
+	}
+	calls = 0;
+	order_broken = false;
+
+	ProducerData data[producer_count];
+	Thread threads[producer_count];
+	for (int i = 0; i < producer_count; i++) {
+		data[i].queue = &queue;
+		data[i].producer = i;
+		data[i].count = count;
+		threads[i].start(producer_function, &data[i]);
+	}
+
+	// Flush while producing, to ensure consuming is also safe at the same time.
+	for (int i = 0; i < 10; i++) {
+		queue.flush();
+	}
+
+	for (int i = 0; i < producer_count; i++) {
+		threads[i].wait_to_finish();
+	}
+	queue.flush();
+
+	CHECK(calls == producer_count * count);
+	CHECK_FALSE(order_broken);
+	CHECK_FALSE(queue.has_messages());
+}
+
+TEST_CASE("[CallQueue] Flushing empties the queue and pages are reused") {
+	CallQueue queue;
+	last_seen.clear();
+	last_seen.resize(1);
+	last_seen[0] = 0;
+	calls = 0;
+	order_broken = false;
+
+	for (int i = 1; i <= 1000; i++) {
+		queue.push_callable(callable_mp_static(&record_call), 0, i);
+	}
+	CHECK(queue.has_messages());
+
+	queue.flush();
+	CHECK(calls == 1000);
+	CHECK_FALSE(order_broken);
+	CHECK_FALSE(queue.has_messages());
+
+	// Reusing the pages after a flush must work the same.
+	for (int i = 1001; i <= 2000; i++) {
+		queue.push_callable(callable_mp_static(&record_call), 0, i);
+	}
+	queue.flush();
+	CHECK(calls == 2000);
+	CHECK_FALSE(order_broken);
+}
+
+static CallQueue *queue_to_clear = nullptr;
+
+static void clear_queue() {
+	queue_to_clear->clear();
+}
+
+TEST_CASE("[CallQueue] Clearing from a deferred call drops the remaining messages") {
+	CallQueue queue;
+	queue_to_clear = &queue;
+	last_seen.clear();
+	last_seen.resize(1);
+	last_seen[0] = 0;
+	calls = 0;
+	order_broken = false;
+
+	queue.push_callable(callable_mp_static(&record_call), 0, 1);
+	queue.push_callable(callable_mp_static(&clear_queue));
+	queue.push_callable(callable_mp_static(&record_call), 0, 2);
+	queue.flush();
+	CHECK(calls == 1);
+	CHECK_FALSE(queue.has_messages());
+
+	// The queue keeps working afterwards.
+	queue.push_callable(callable_mp_static(&record_call), 0, 2);
+	queue.flush();
+	CHECK(calls == 2);
+	CHECK_FALSE(order_broken);
+
+	queue_to_clear = nullptr;
+}
+
+class NativeCallTarget : public Object {
+	GDCLASS(NativeCallTarget, Object);
+
+public:
+	int total = 0;
+	String text;
+
+	void add(int p_value, const String &p_text) {
+		total += p_value;
+		text += p_text;
+	}
+};
+
+TEST_CASE("[CallQueue] Native calls are flushed in order and skipped for freed objects") {
+	CallQueue queue;
+	NativeCallTarget *target = memnew(NativeCallTarget);
+	NativeCallTarget *freed = memnew(NativeCallTarget);
+
+	for (int i = 0; i < 3; i++) {
+		queue.push_native(target, &NativeCallTarget::add, i, itos(i));
+		queue.push_native(freed, &NativeCallTarget::add, i, itos(i));
+	}
+	memdelete(freed);
+
+	CHECK(queue.has_messages());
+	queue.flush();
+	CHECK(target->total == 3);
+	CHECK(target->text == "012");
+	CHECK_FALSE(queue.has_messages());
+
+	// Arguments are destroyed on clear as well, so nothing must leak here.
+	queue.push_native(target, &NativeCallTarget::add, 10, String("unused"));
+	queue.clear();
+	CHECK(target->total == 3);
+	CHECK_FALSE(queue.has_messages());
+
+	memdelete(target);
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
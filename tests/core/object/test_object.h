@@ -58,6 +58,28 @@ public:
 	int get_property() const { return property_value; }
 };
 
+class _TestSignalReceiver : public Object {
+	GDCLASS(_TestSignalReceiver, Object);
+
+public:
+	int calls = 0;
+	Object *emitter = nullptr;
+	_TestSignalReceiver *to_disconnect = nullptr;
+	_TestSignalReceiver *to_connect = nullptr;
+
+	void receive() {
+		calls++;
+		if (to_disconnect) {
+			emitter->disconnect("my_custom_signal", callable_mp(to_disconnect, &_TestSignalReceiver::receive));
+			to_disconnect = nullptr;
+		}
+		if (to_connect) {
+			emitter->connect("my_custom_signal", callable_mp(to_connect, &_TestSignalReceiver::receive));
+			to_connect = nullptr;
+		}
+	}
+};
+
 namespace TestObject {
 
 class _MockScriptInstance : public ScriptInstance {
@@ -424,6 +446,38 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Connecting or disconnecting during emission should only affect the next emission") {
+		_TestSignalReceiver receivers[3];
+		for (_TestSignalReceiver &receiver : receivers) {
+			receiver.emitter = &object;
+		}
+		object.connect("my_custom_signal", callable_mp(&receivers[0], &_TestSignalReceiver::receive));
+		object.connect("my_custom_signal", callable_mp(&receivers[1], &_TestSignalReceiver::receive));
+		receivers[0].to_disconnect = &receivers[1];
+		receivers[0].to_connect = &receivers[2];
+
+		// Connections are called in order, so the disconnected receiver is still called this time.
+		object.emit_signal("my_custom_signal");
+		CHECK(receivers[0].calls == 1);
+		CHECK(receivers[1].calls == 1);
+		CHECK(receivers[2].calls == 0);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(receivers[0].calls == 2);
+		CHECK(receivers[1].calls == 1);
+		CHECK(receivers[2].calls == 1);
+	}
+
+	SUBCASE("One shot connections should only be called once") {
+		_TestSignalReceiver receiver;
+		object.connect("my_custom_signal", callable_mp(&receiver, &_TestSignalReceiver::receive), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK(receiver.calls == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&receiver, &_TestSignalReceiver::receive)));
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -0,0 +1,168 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/os/frame_arena.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Last allocation is resized in place") {
+	FrameArena::end_frame();
+
+	uint8_t *first = (uint8_t *)FrameArena::alloc(100);
+	uint8_t *second = (uint8_t *)FrameArena::alloc(100);
+	CHECK(((uintptr_t)first % FrameArena::ALIGN) == 0);
+	CHECK(((uintptr_t)second % FrameArena::ALIGN) == 0);
+	CHECK(second > first);
+
+	memset(second, 7, 100);
+	CHECK(FrameArena::realloc(second, 1000) == second);
+	CHECK(second[99] == 7);
+
+	// Not the last allocation anymore, so it's moved.
+	memset(first, 3, 100);
+	uint8_t *moved = (uint8_t *)FrameArena::realloc(first, 200);
+	CHECK(moved != first);
+	CHECK(moved[0] == 3);
+	CHECK(moved[99] == 3);
+
+	// Freeing the last allocation gives its memory back.
+	FrameArena::free(moved);
+	uint8_t *third = (uint8_t *)FrameArena::alloc(50);
+	CHECK(third == moved);
+
+	FrameArena::free(third);
+	FrameArena::free(second);
+}
+
+TEST_CASE("[FrameArena] Memory is reclaimed after the frame") {
+	FrameArena::end_frame();
+
+	void *first = FrameArena::alloc(64);
+	FrameArena::free(FrameArena::alloc(64));
+	void *kept = FrameArena::alloc(FrameArena::CHUNK_SIZE); // Oversized.
+	FrameArena::free(first);
+	FrameArena::end_frame();
+
+	CHECK(FrameArena::get_frame_allocations() == 3);
+	CHECK(FrameArena::get_frame_bytes() == 128 + FrameArena::CHUNK_SIZE);
+
+	// The oversized allocation is still alive, but it doesn't keep the other chunk from being reused.
+	void *next = FrameArena::alloc(64);
+	CHECK(next == first);
+	FrameArena::free(next);
+	FrameArena::end_frame();
+
+	// An allocation still alive keeps its own chunk.
+	void *pinned = FrameArena::alloc(64);
+	void *after = FrameArena::alloc(64);
+	FrameArena::end_frame();
+	void *other = FrameArena::alloc(64);
+	CHECK(other != pinned);
+	CHECK(other != after);
+	FrameArena::free(other);
+	FrameArena::free(after);
+	FrameArena::free(pinned);
+	FrameArena::free(kept);
+	FrameArena::end_frame();
+
+	// Everything was freed, so it starts over on the next frame.
+	void *reused = FrameArena::alloc(64);
+	CHECK((reused == first || reused == other));
+	FrameArena::free(reused);
+}
+
+TEST_CASE("[FrameArena] Memory is reclaimed without ending the frame") {
+	FrameArena::end_frame();
+
+	// Threads not following the main loop frames must not keep growing.
+	void *first = FrameArena::alloc(64);
+	void *second = FrameArena::alloc(64);
+	FrameArena::free(first);
+	FrameArena::free(second);
+	void *third = FrameArena::alloc(64);
+	CHECK(third == first);
+	FrameArena::free(third);
+
+	void *kept = FrameArena::alloc(64);
+	for (int i = 0; i < 64; i++) {
+		FrameArena::free(FrameArena::alloc(FrameArena::CHUNK_SIZE / 4));
+		FrameArena::free(FrameArena::alloc(64));
+	}
+	FrameArena::free(kept);
+}
+
+TEST_CASE("[FrameArena] Shrinking updates the frame bytes") {
+	FrameArena::end_frame();
+
+	void *mem = FrameArena::alloc(1000);
+	mem = FrameArena::realloc(mem, 2000);
+	mem = FrameArena::realloc(mem, 500);
+	FrameArena::free(mem);
+	FrameArena::end_frame();
+
+	CHECK(FrameArena::get_frame_bytes() == 500);
+}
+
+TEST_CASE("[FrameArena] Containers") {
+	FrameArena::end_frame();
+
+	FrameLocalVector<int> vector;
+	List<int, FrameAllocator> list;
+	HashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, FrameTypedAllocator<HashMapElement<int, int>>> map;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+		list.push_back(i * 2);
+		map.insert(i, i * 3);
+	}
+
+	bool valid = true;
+	int i = 0;
+	for (const int &E : list) {
+		valid = valid && vector[i] == i && E == i * 2 && map[i] == i * 3;
+		i++;
+	}
+	CHECK(valid);
+	map.erase(500);
+	CHECK_FALSE(map.has(500));
+
+	FrameArena::end_frame();
+	CHECK(FrameArena::get_frame_allocations() >= 2000);
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
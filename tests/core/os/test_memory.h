@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Memory] Tagged allocations") {
+	const Memory::Tag tag = Memory::TAG_NAVIGATION;
+	const uint64_t usage = Memory::get_tag_usage(tag);
+	const uint64_t alloc_count = Memory::get_tag_alloc_count(tag);
+
+	void *untagged = memalloc(100);
+	CHECK(Memory::get_tag_usage(tag) == usage);
+
+	void *tagged = nullptr;
+	{
+		Memory::TagScope tag_scope(tag);
+		tagged = memalloc(100);
+		{
+			// The innermost scope wins.
+			Memory::TagScope inner_tag_scope(Memory::TAG_SCRIPT);
+			memfree(memalloc(10));
+		}
+		CHECK(Memory::get_tag_usage(tag) == usage + 100);
+	}
+	CHECK(Memory::get_tag_alloc_count(tag) == alloc_count + 1);
+	CHECK(Memory::get_tag_max_usage(tag) >= usage + 100);
+
+	// Reallocations keep the tag of the allocation, whatever the current scope is.
+	tagged = memrealloc(tagged, 300);
+	untagged = memrealloc(untagged, 300);
+	CHECK(Memory::get_tag_usage(tag) == usage + 300);
+	tagged = memrealloc(tagged, 50);
+	CHECK(Memory::get_tag_usage(tag) == usage + 50);
+
+	memfree(tagged);
+	memfree(untagged);
+	CHECK(Memory::get_tag_usage(tag) == usage);
+}
+
+TEST_CASE("[Memory] memnew_tagged and TaggedAllocator") {
+	const Memory::Tag tag = Memory::TAG_NAVIGATION;
+	const uint64_t usage = Memory::get_tag_usage(tag);
+
+	LocalVector<int> *vector = memnew_tagged(LocalVector<int>, tag);
+	CHECK(Memory::get_tag_usage(tag) == usage + sizeof(LocalVector<int>));
+	// Only the allocations made while constructing are tagged.
+	vector->push_back(1);
+	CHECK(Memory::get_tag_usage(tag) == usage + sizeof(LocalVector<int>));
+	memdelete(vector);
+	CHECK(Memory::get_tag_usage(tag) == usage);
+
+	LocalVector<int, uint32_t, false, false, TaggedAllocator<Memory::TAG_NAVIGATION>> tagged_vector;
+	for (int i = 0; i < 100; i++) {
+		tagged_vector.push_back(i);
+	}
+	CHECK(Memory::get_tag_usage(tag) >= usage + 100 * sizeof(int));
+	tagged_vector.reset();
+	CHECK(Memory::get_tag_usage(tag) == usage);
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Memory] Tag names") {
+	for (int i = 0; i < Memory::TAG_MAX; i++) {
+		CHECK(strlen(Memory::get_tag_name(Memory::Tag(i))) > 0);
+	}
+	CHECK(String(Memory::get_tag_name(Memory::TAG_DEFAULT)) == "default");
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
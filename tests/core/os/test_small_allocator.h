@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*  test_small_allocator.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SMALL_ALLOCATOR_H
+#define TEST_SMALL_ALLOCATOR_H
+
+#include "core/os/small_allocator.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/array.h"
+#include "core/variant/dictionary.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallAllocator {
+
+TEST_CASE("[SmallAllocator] Size classes") {
+	for (uint32_t size = 1; size <= SmallAllocator::MAX_SIZE; size++) {
+		const uint32_t size_class = SmallAllocator::get_size_class(size);
+		CHECK(size_class < SmallAllocator::SIZE_CLASS_COUNT);
+		CHECK(SmallAllocator::get_size_class_block_size(size_class) >= size);
+		if (size_class > 0) {
+			// The smallest size class fitting the size is used.
+			CHECK(SmallAllocator::get_size_class_block_size(size_class - 1) < size);
+		}
+	}
+	CHECK(SmallAllocator::get_size_class_block_size(SmallAllocator::SIZE_CLASS_COUNT - 1) == SmallAllocator::MAX_SIZE);
+	CHECK_FALSE(SmallAllocator::is_small(0));
+	CHECK_FALSE(SmallAllocator::is_small(SmallAllocator::MAX_SIZE + 1));
+}
+
+TEST_CASE("[SmallAllocator] Allocation and statistics") {
+	const uint32_t size = 200;
+	const uint32_t size_class = SmallAllocator::get_size_class(size);
+	const SmallAllocator::SizeClassStats before = SmallAllocator::get_size_class_stats(size_class);
+
+	// More than a slab, so blocks are exchanged with the shared pool.
+	const uint32_t count = 2 * SmallAllocator::SLAB_SIZE / SmallAllocator::get_size_class_block_size(size_class);
+	LocalVector<uint8_t *> blocks;
+	for (uint32_t i = 0; i < count; i++) {
+		uint8_t *block = (uint8_t *)SmallAllocator::alloc(size);
+		memset(block, i & 0xFF, size);
+		blocks.push_back(block);
+	}
+
+	SmallAllocator::SizeClassStats stats = SmallAllocator::get_size_class_stats(size_class);
+	CHECK(stats.block_size == SmallAllocator::get_size_class_block_size(size_class));
+	CHECK(stats.allocations - before.allocations == count);
+	CHECK(stats.in_use - before.in_use == count);
+	CHECK(stats.reserved >= 2 * SmallAllocator::SLAB_SIZE);
+
+	bool intact = true;
+	for (uint32_t i = 0; i < count; i++) {
+		for (uint32_t j = 0; j < size; j++) {
+			intact = intact && blocks[i][j] == (i & 0xFF);
+		}
+		SmallAllocator::free(blocks[i], size);
+	}
+	CHECK_MESSAGE(intact, "Blocks must not overlap.");
+
+	stats = SmallAllocator::get_size_class_stats(size_class);
+	CHECK(stats.in_use == before.in_use);
+	CHECK(stats.allocations - before.allocations == count);
+}
+
+struct ThreadData {
+	LocalVector<void *> blocks;
+	uint32_t size = 0;
+};
+
+static void _alloc_blocks(void *p_userdata) {
+	ThreadData *data = (ThreadData *)p_userdata;
+	for (uint32_t i = 0; i < 1000; i++) {
+		data->blocks.push_back(SmallAllocator::alloc(data->size));
+	}
+}
+
+TEST_CASE("[SmallAllocator] Freeing blocks allocated by other threads") {
+	const uint32_t size = 1000;
+	const uint32_t size_class = SmallAllocator::get_size_class(size);
+	const SmallAllocator::SizeClassStats before = SmallAllocator::get_size_class_stats(size_class);
+
+	ThreadData data[4];
+	Thread threads[4];
+	for (int i = 0; i < 4; i++) {
+		data[i].size = size;
+		threads[i].start(_alloc_blocks, &data[i]);
+	}
+	for (int i = 0; i < 4; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	// The threads exited, their statistics must have been kept.
+	SmallAllocator::SizeClassStats stats = SmallAllocator::get_size_class_stats(size_class);
+	CHECK(stats.allocations - before.allocations >= 4000);
+	CHECK(stats.in_use - before.in_use >= 4000);
+
+	for (int i = 0; i < 4; i++) {
+		for (void *block : data[i].blocks) {
+			SmallAllocator::free(block, size);
+		}
+	}
+
+	stats = SmallAllocator::get_size_class_stats(size_class);
+	CHECK(stats.in_use == before.in_use);
+}
+
+#ifdef SMALL_ALLOCATOR_ENABLED
+TEST_CASE("[SmallAllocator] Allocation heavy workload goes through the small allocator") {
+	uint64_t before = 0;
+	for (uint32_t i = 0; i < SmallAllocator::SIZE_CLASS_COUNT; i++) {
+		before += SmallAllocator::get_size_class_stats(i).allocations;
+	}
+
+	String string;
+	Array array;
+	Dictionary dictionary;
+	for (int i = 0; i < 1000; i++) {
+		string += itos(i);
+		array.push_back(string.length());
+		dictionary[i] = string.substr(0, 8);
+	}
+	CHECK(array.size() == 1000);
+	CHECK(dictionary.size() == 1000);
+
+	uint64_t after = 0;
+	for (uint32_t i = 0; i < SmallAllocator::SIZE_CLASS_COUNT; i++) {
+		after += SmallAllocator::get_size_class_stats(i).allocations;
+	}
+	CHECK(after - before >= 1000);
+}
+#endif // SMALL_ALLOCATOR_ENABLED
+
+} // namespace TestSmallAllocator
+
+#endif // TEST_SMALL_ALLOCATOR_H
@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName from_cstring = "test_string_name_interning";
+	const StringName from_string = String("test_string_name_interning");
+	const StringName from_static = StringName(StaticCString::create("test_string_name_interning"));
+
+	CHECK(from_cstring.data_unique_pointer() == from_string.data_unique_pointer());
+	CHECK(from_cstring.data_unique_pointer() == from_static.data_unique_pointer());
+	CHECK(from_cstring == from_string);
+	CHECK(String(from_static) == "test_string_name_interning");
+
+	const StringName other = "test_string_name_interning_other";
+	CHECK(other != from_cstring);
+}
+
+TEST_CASE("[StringName] Search") {
+	CHECK(StringName::search("test_string_name_never_created") == StringName());
+
+	const StringName name = "test_string_name_search";
+	CHECK(StringName::search("test_string_name_search") == name);
+	CHECK(StringName::search(String("test_string_name_search")) == name);
+	CHECK(StringName::search(U"test_string_name_search") == name);
+}
+
+TEST_CASE("[StringName] Releasing and recreating a name") {
+	{
+		const StringName name = "test_string_name_released";
+		CHECK(StringName::search("test_string_name_released") == name);
+	}
+	// The last reference was dropped, so the name is no longer interned.
+	CHECK(StringName::search("test_string_name_released") == StringName());
+
+	const StringName name = "test_string_name_released";
+	CHECK(StringName::search("test_string_name_released") == name);
+	CHECK(String(name) == "test_string_name_released");
+}
+
+TEST_CASE("[StringName] Many names") {
+	// Enough names to grow the table, interleaved with releases to leave tombstones behind.
+	const int count = 50000;
+	LocalVector<StringName> names;
+	names.resize(count);
+	for (int i = 0; i < count; i++) {
+		names[i] = "test_string_name_many_" + itos(i);
+		if (i % 3 == 0) {
+			StringName transient = "test_string_name_transient_" + itos(i);
+		}
+	}
+
+	bool found = true;
+	for (int i = 0; i < count; i++) {
+		const String name = "test_string_name_many_" + itos(i);
+		if (StringName::search(name) != names[i] || StringName(name).data_unique_pointer() != names[i].data_unique_pointer()) {
+			found = false;
+		}
+	}
+	CHECK_MESSAGE(found, "Every name must still be found after the table was resized.");
+	CHECK(StringName::search("test_string_name_transient_0") == StringName());
+}
+
+struct ThreadData {
+	int index = 0;
+	LocalVector<StringName> names;
+};
+
+static const int THREAD_COUNT = 4;
+static const int THREAD_NAME_COUNT = 2000;
+
+static void _intern_names(void *p_userdata) {
+	ThreadData *data = (ThreadData *)p_userdata;
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < THREAD_NAME_COUNT; i++) {
+			// Shared names are looked up by every thread, private ones are created and released.
+			const StringName shared = "test_string_name_shared_" + itos(i);
+			const StringName own = "test_string_name_thread_" + itos(data->index) + "_" + itos(i);
+			if (round == 0) {
+				data->names.push_back(shared);
+			}
+		}
+	}
+}
+
+TEST_CASE("[StringName] Interning from several threads") {
+	ThreadData data[THREAD_COUNT];
+	Thread threads[THREAD_COUNT];
+	for (int i = 0; i < THREAD_COUNT; i++) {
+		data[i].index = i;
+		threads[i].start(_intern_names, &data[i]);
+	}
+	for (int i = 0; i < THREAD_COUNT; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	bool same = true;
+	for (int i = 0; i < THREAD_NAME_COUNT; i++) {
+		const StringName expected = "test_string_name_shared_" + itos(i);
+		for (int j = 0; j < THREAD_COUNT; j++) {
+			if (data[j].names[i].data_unique_pointer() != expected.data_unique_pointer()) {
+				same = false;
+			}
+		}
+	}
+	CHECK_MESSAGE(same, "Every thread must have interned the same names.");
+	CHECK(StringName::search("test_string_name_thread_0_0") == StringName());
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*  test_string_simd.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_SIMD_H
+#define TEST_STRING_SIMD_H
+
+#include "core/math/random_pcg.h"
+#include "core/string/string_simd.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringSIMD {
+
+// Mostly printable ASCII, with some uppercase, non-ASCII and out of range characters.
+static char32_t _random_char(RandomPCG &p_rng) {
+	switch (p_rng.rand(20)) {
+		case 0:
+			return 0x80 + p_rng.rand(0x10000);
+		case 1:
+			return 'A' + p_rng.rand(26);
+		case 2:
+			return 0xffffffff - p_rng.rand(4);
+		default:
+			return 0x20 + p_rng.rand(95);
+	}
+}
+
+static char _random_byte(RandomPCG &p_rng) {
+	switch (p_rng.rand(30)) {
+		case 0:
+			return 0;
+		case 1:
+			return '\r';
+		case 2:
+			return (char)(0x80 + p_rng.rand(0x80));
+		default:
+			return (char)(0x20 + p_rng.rand(95));
+	}
+}
+
+static int _scalar_ascii_length(const char32_t *p_str, int p_len) {
+	int i = 0;
+	while (i < p_len && p_str[i] <= 0x7f) {
+		i++;
+	}
+	return i;
+}
+
+TEST_CASE("[StringSIMD] Kernels match the scalar loops") {
+	RandomPCG rng(12345);
+	bool find_ok = true;
+	bool ascii_ok = true;
+	bool convert_ok = true;
+	bool case_ok = true;
+	bool hash_ok = true;
+
+	for (int iteration = 0; iteration < 5000; iteration++) {
+		const int len = rng.rand(100);
+		LocalVector<char32_t> str;
+		str.resize(len + 1);
+		for (char32_t &c : str) {
+			c = _random_char(rng);
+		}
+		const char32_t *s = str.ptr();
+
+		const char32_t needle = str[rng.rand(len + 1)];
+		int expected = -1;
+		for (int i = 0; i < len; i++) {
+			if (s[i] == needle) {
+				expected = i;
+				break;
+			}
+		}
+		find_ok = find_ok && StringSIMD::find_char(s, len, needle) == expected;
+
+		const int ascii = _scalar_ascii_length(s, len);
+		ascii_ok = ascii_ok && StringSIMD::ascii_length(s, len) == ascii;
+
+		LocalVector<char> narrow;
+		narrow.resize(len + 1);
+		convert_ok = convert_ok && StringSIMD::narrow_ascii(s, narrow.ptr(), len) == ascii;
+		for (int i = 0; i < ascii; i++) {
+			convert_ok = convert_ok && narrow[i] == (char)s[i];
+		}
+
+		int first_upper = 0;
+		while (first_upper < len && s[first_upper] <= 0x7f && !(s[first_upper] >= 'A' && s[first_upper] <= 'Z')) {
+			first_upper++;
+		}
+		case_ok = case_ok && StringSIMD::find_ascii_range(s, len, 'A', 'Z') == first_upper;
+
+		LocalVector<char32_t> converted;
+		converted.resize(len + 1);
+		case_ok = case_ok && StringSIMD::ascii_to_lower(s, converted.ptr(), len) == ascii;
+		for (int i = 0; i < ascii; i++) {
+			case_ok = case_ok && converted[i] == ((s[i] >= 'A' && s[i] <= 'Z') ? s[i] + 32 : s[i]);
+		}
+		case_ok = case_ok && StringSIMD::ascii_to_upper(s, converted.ptr(), len) == ascii;
+		for (int i = 0; i < ascii; i++) {
+			case_ok = case_ok && converted[i] == ((s[i] >= 'a' && s[i] <= 'z') ? s[i] - 32 : s[i]);
+		}
+
+		uint32_t hash = 5381;
+		for (int i = 0; i < len; i++) {
+			hash = hash * 33 + s[i];
+		}
+		hash_ok = hash_ok && StringSIMD::hash(s, len) == hash;
+
+		LocalVector<char> bytes;
+		bytes.resize(len + 1);
+		for (char &c : bytes) {
+			c = _random_byte(rng);
+		}
+		int plain = 0;
+		while (plain < len && bytes[plain] != 0 && bytes[plain] != '\r' && (uint8_t)bytes[plain] < 0x80) {
+			plain++;
+		}
+		ascii_ok = ascii_ok && StringSIMD::ascii_length(bytes.ptr(), len) == plain;
+
+		LocalVector<char32_t> wide;
+		wide.resize(len + 1);
+		convert_ok = convert_ok && StringSIMD::widen_ascii(bytes.ptr(), wide.ptr(), len) == plain;
+		for (int i = 0; i < plain; i++) {
+			convert_ok = convert_ok && wide[i] == (char32_t)bytes[i];
+		}
+	}
+
+	CHECK(find_ok);
+	CHECK(ascii_ok);
+	CHECK(convert_ok);
+	CHECK(case_ok);
+	CHECK(hash_ok);
+}
+
+TEST_CASE("[StringSIMD] String operations around block boundaries") {
+	// Lengths around the vector widths, with the interesting character at every position.
+	for (int len = 1; len < 40; len++) {
+		for (int pos = 0; pos < len; pos++) {
+			String ascii;
+			for (int i = 0; i < len; i++) {
+				// Letters from 'a' to 't', so the marker is the only 'x' in any case.
+				ascii += char32_t((i == pos) ? 'X' : 'a' + (i % 20));
+			}
+			CHECK(ascii.find_char('X') == pos);
+			CHECK(ascii.find("X") == pos);
+			CHECK(ascii.find(String("X") + ascii.substr(pos + 1)) == pos);
+			CHECK(ascii.to_lower().find_char('x') == pos);
+			CHECK(ascii.to_upper().find_char('X') == pos);
+
+			String unicode = ascii;
+			unicode[pos] = U'É';
+			CHECK(unicode.to_lower()[pos] == U'é');
+			CHECK(unicode.to_upper().find_char(U'É') == pos);
+
+			const CharString utf8 = unicode.utf8();
+			CHECK(utf8.length() == len + 1);
+			CHECK(String::utf8(utf8.get_data()) == unicode);
+			CHECK(String::utf8(utf8.get_data(), utf8.length()) == unicode);
+			CHECK(unicode.hash() == String::hash(unicode.get_data()));
+		}
+	}
+}
+
+TEST_CASE("[StringSIMD] Carriage returns are skipped when parsing UTF-8") {
+	const char *text = "A line that is longer than one vector\r\nand the next one\r\n";
+	String parsed;
+	parsed.parse_utf8(text, -1, true);
+	CHECK(parsed == "A line that is longer than one vector\nand the next one\n");
+	parsed.parse_utf8(text, -1, false);
+	CHECK(parsed == text);
+}
+
+} // namespace TestStringSIMD
+
+#endif // TEST_STRING_SIMD_H
@@ -0,0 +1,156 @@
+/**************************************************************************/
+/*  test_flat_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/templates/flat_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert element") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[FlatHashMap] Overwrite element") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[FlatHashMap] Erase via element") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[FlatHashMap] Erase via key") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	CHECK(map.erase(42));
+	CHECK(!map.erase(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[FlatHashMap] Iteration keeps insertion order across erase") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+	map.erase(0);
+	map.insert(7, 49);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+	expected.push_back(Pair<int, int>(7, 49));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == expected.size());
+
+	const FlatHashMap<int, int> const_map = map;
+	for (FlatHashMap<int, int>::ConstIterator E = const_map.last(); E; --E) {
+		--idx;
+		CHECK(expected[idx] == Pair<int, int>(E->key, E->value));
+	}
+	CHECK(idx == 0);
+}
+
+TEST_CASE("[FlatHashMap] Growth and reuse of erased entries") {
+	FlatHashMap<String, int> map;
+	for (int i = 0; i < 1000; i++) {
+		map[itos(i)] = i;
+	}
+	CHECK(map.size() == 1000);
+
+	// Churn through many more keys than the map ever holds at once.
+	const uint32_t capacity = map.get_capacity();
+	for (int i = 0; i < 10000; i++) {
+		CHECK(map.erase(itos(i)));
+		map.insert(itos(i + 1000), i + 1000);
+	}
+	CHECK(map.size() == 1000);
+	CHECK(map.get_capacity() <= capacity * 2);
+
+	int expected = 10000;
+	bool all_found = true;
+	for (const KeyValue<String, int> &E : map) {
+		all_found = all_found && E.key == itos(expected) && E.value == expected;
+		expected++;
+	}
+	CHECK(all_found);
+	CHECK(!map.has("0"));
+	CHECK(map.has("10999"));
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.begin());
+}
+
+TEST_CASE("[FlatHashMap] Insert a key and value stored in the map") {
+	FlatHashMap<String, String> map;
+	map.insert("a", "b");
+	// Fill the map up to the point where the next insertion has to grow it.
+	for (int i = 0; map.size() < map.get_capacity() - map.get_capacity() / 8; i++) {
+		map.insert(itos(i), itos(i));
+	}
+
+	const KeyValue<String, String> &first = *map.begin();
+	map.insert(first.value, first.key);
+	CHECK(map["b"] == "a");
+}
+
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
@@ -0,0 +1,151 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_WORK_STEALING_DEQUE_H
+#define TEST_WORK_STEALING_DEQUE_H
+
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner pops LIFO, thieves steal FIFO") {
+	WorkStealingDeque<uintptr_t, 8> deque;
+	uintptr_t value = 0;
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+
+	for (uintptr_t i = 1; i <= 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.is_empty());
+
+	CHECK(deque.pop(value));
+	CHECK(value == 4);
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+	CHECK(deque.steal(value));
+	CHECK(value == 2);
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Push fails when full") {
+	WorkStealingDeque<uintptr_t, 4> deque;
+	uintptr_t value = 0;
+
+	for (uintptr_t i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.push(4));
+
+	// Freeing a slot from either end makes room again, wrapping around the buffer.
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.push(4));
+	CHECK_FALSE(deque.push(5));
+	for (uintptr_t i = 4; i >= 1; i--) {
+		CHECK(deque.pop(value));
+		CHECK(value == i);
+	}
+	CHECK(deque.is_empty());
+}
+
+struct StealData {
+	WorkStealingDeque<uintptr_t, 256> deque;
+	SafeFlag done;
+	SafeNumeric<uint64_t> sum;
+	SafeNumeric<uint32_t> taken;
+};
+
+static void thief_function(void *p_user) {
+	StealData *data = (StealData *)p_user;
+	uintptr_t value = 0;
+	while (!data->done.is_set() || !data->deque.is_empty()) {
+		if (data->deque.steal(value)) {
+			data->sum.add(value);
+			data->taken.increment();
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingDeque] Every element is taken exactly once under contention") {
+	const uint32_t thief_count = 3;
+	const uint32_t element_count = 100000;
+
+	StealData data;
+	Thread thieves[thief_count];
+	for (uint32_t i = 0; i < thief_count; i++) {
+		thieves[i].start(thief_function, &data);
+	}
+
+	uint64_t expected_sum = 0;
+	uintptr_t value = 0;
+	for (uint32_t i = 1; i <= element_count; i++) {
+		expected_sum += i;
+		while (!data.deque.push(i)) {
+			// Full, help draining.
+			if (data.deque.pop(value)) {
+				data.sum.add(value);
+				data.taken.increment();
+			}
+		}
+		if (i % 3 == 0 && data.deque.pop(value)) {
+			data.sum.add(value);
+			data.taken.increment();
+		}
+	}
+	while (data.deque.pop(value)) {
+		data.sum.add(value);
+		data.taken.increment();
+	}
+
+	data.done.set();
+	for (uint32_t i = 0; i < thief_count; i++) {
+		thieves[i].wait_to_finish();
+	}
+
+	CHECK(data.taken.get() == element_count);
+	CHECK(data.sum.get() == expected_sum);
+}
+
+} // namespace TestWorkStealingDeque
+
+#endif // TEST_WORK_STEALING_DEQUE_H
@@ -106,6 +106,138 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static SafeNumeric<uint32_t> nested_counter;
+
+static void static_nested_group_test(void *p_arg, uint32_t p_index) {
+	nested_counter.increment();
+}
+
+static void static_nested_task_test(void *p_arg) {
+	// Posted from a pool thread, so these go to the thread's own queue and are stolen by others.
+	const uint32_t subtasks = (uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	for (uint32_t i = 0; i < subtasks; i++) {
+		tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_task_test, (void *)(uintptr_t)0, true));
+	}
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_test, nullptr, 16, -1, true);
+	for (WorkerThreadPool::TaskID task : tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	nested_counter.increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Process tasks and groups posted from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const uint32_t count = Math::pow(2.0f, Math::random(0.0f, 4.0f));
+		const uint32_t subtasks = Math::pow(2.0f, Math::random(0.0f, 4.0f));
+
+		nested_counter.set(0);
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (uint32_t i = 0; i < count; i++) {
+			tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_task_test, (void *)(uintptr_t)subtasks, true));
+		}
+		for (WorkerThreadPool::TaskID task : tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		}
+
+		// Each task runs itself plus a 16 element group, and so does every subtask.
+		CHECK(nested_counter.get() == count * (1 + subtasks) * 17);
+	}
+}
+
+struct DependencyCheck {
+	SafeNumeric<uint32_t> stage;
+	SafeNumeric<uint32_t> elements_done;
+	SafeFlag order_broken;
+	uint32_t elements = 0;
+
+	void first_task(void *p_arg) {
+		stage.set(1);
+	}
+	void group_task(uint32_t p_index, void *p_arg) {
+		if (stage.get() != 1) {
+			order_broken.set();
+		}
+		elements_done.increment();
+	}
+	void last_task(void *p_arg) {
+		if (stage.get() != 1 || elements_done.get() != elements) {
+			order_broken.set();
+		}
+		stage.set(2);
+	}
+};
+
+TEST_CASE("[WorkerThreadPool] Tasks and groups start after their dependencies") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const bool high_priority = Math::rand() % 2;
+
+		DependencyCheck check;
+		check.elements = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		WorkerThreadPool::TaskID first = pool->add_template_task(&check, &DependencyCheck::first_task, nullptr, high_priority);
+		WorkerThreadPool::GroupID group = pool->add_template_group_task_with_dependencies(&check, &DependencyCheck::group_task, nullptr, check.elements, { first }, -1, high_priority);
+		// Depending on an already awaited (hence invalid) ID must not hold the task back.
+		WorkerThreadPool::TaskID last = pool->add_template_task_with_dependencies(&check, &DependencyCheck::last_task, nullptr, { first, group, WorkerThreadPool::INVALID_TASK_ID }, high_priority);
+
+		pool->wait_for_task_completion(last);
+		CHECK(check.stage.get() == 2);
+		CHECK(check.elements_done.get() == check.elements);
+		CHECK_FALSE(check.order_broken.is_set());
+
+		pool->wait_for_group_task_completion(group);
+		pool->wait_for_task_completion(first);
+	}
+}
+
+struct ParallelCheck {
+	LocalVector<SafeNumeric<uint32_t>> visits;
+	SafeFlag bad_range;
+
+	void visit_range(uint32_t p_from, uint32_t p_to, uint32_t p_slot, uint32_t p_min_chunk) {
+		if (p_from >= p_to || p_slot >= WorkerThreadPool::get_singleton()->get_parallel_slot_count() || (p_to - p_from < p_min_chunk && p_to != visits.size())) {
+			bad_range.set();
+		}
+		for (uint32_t i = p_from; i < p_to; i++) {
+			visits[i].increment();
+		}
+	}
+
+	void sum_range(uint32_t p_from, uint32_t p_to, uint64_t &r_sum, void *p_userdata) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			r_sum += i;
+		}
+	}
+
+	void merge_sum(uint64_t &r_into, const uint64_t &p_sum) {
+		r_into += p_sum;
+	}
+};
+
+TEST_CASE("[WorkerThreadPool] Parallel for and reduce") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const uint32_t count = Math::pow(2.0f, Math::random(0.0f, 14.0f));
+		const uint32_t min_chunk = Math::pow(2.0f, Math::random(0.0f, 6.0f));
+
+		ParallelCheck check;
+		check.visits.resize(count);
+		WorkerThreadPool::get_singleton()->parallel_for(&check, &ParallelCheck::visit_range, min_chunk, count, min_chunk);
+
+		bool all_visited_once = true;
+		for (uint32_t i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_visited_once &= check.visits[i].get() == 1;
+		}
+		CHECK(all_visited_once);
+		CHECK_FALSE(check.bad_range.is_set());
+
+		uint64_t sum = WorkerThreadPool::get_singleton()->parallel_reduce(&check, &ParallelCheck::sum_range, &ParallelCheck::merge_sum, (void *)nullptr, count, (uint64_t)0, min_chunk);
+		CHECK(sum == (uint64_t)count * (count - 1) / 2);
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -545,6 +545,45 @@ TEST_CASE("[Array] Recursive self comparison") {
 	a2.clear();
 }
 
+TEST_CASE("[Array] Conversion to packed arrays") {
+	Array typed;
+	typed.set_typed(Variant::VECTOR3, StringName(), Variant());
+	typed.push_back(Vector3(1, 2, 3));
+	typed.push_back(Vector3(4, 5, 6));
+
+	PackedVector3Array vectors = Variant(typed);
+	REQUIRE(vectors.size() == 2);
+	CHECK(vectors[0] == Vector3(1, 2, 3));
+	CHECK(vectors[1] == Vector3(4, 5, 6));
+
+	// Elements of other types are still converted.
+	Array mixed;
+	mixed.push_back(1);
+	mixed.push_back(2.75);
+	mixed.push_back(true);
+	mixed.push_back(Vector2());
+
+	Variant mixed_variant = mixed;
+	PackedInt32Array ints = mixed_variant;
+	REQUIRE(ints.size() == 4);
+	CHECK(ints[0] == 1);
+	CHECK(ints[1] == 2);
+	CHECK(ints[2] == 1);
+	CHECK(ints[3] == 0);
+
+	PackedFloat64Array floats = mixed_variant;
+	REQUIRE(floats.size() == 4);
+	CHECK(floats[0] == 1.0);
+	CHECK(floats[1] == 2.75);
+
+	Callable::CallError ce;
+	Variant constructed;
+	const Variant *args[1] = { &mixed_variant };
+	Variant::construct(Variant::PACKED_FLOAT32_ARRAY, constructed, args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(constructed == Variant(PackedFloat32Array({ 1.0f, 2.75f, 1.0f, 0.0f })));
+}
+
 } // namespace TestArray
 
 #endif // TEST_ARRAY_H
@@ -537,6 +537,47 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Named lookups") {
+	Dictionary d;
+	d["position"] = 1;
+	d[StringName("velocity")] = 2;
+	d[""] = 3;
+	d[4] = 4;
+
+	// StringName keys are stored as String.
+	CHECK(d.keys()[1].get_type() == Variant::STRING);
+
+	CHECK(d.has_named("position"));
+	CHECK(d.has_named(StringName("velocity")));
+	CHECK(d.has_named(StringName()));
+	CHECK_FALSE(d.has_named("4"));
+	CHECK_FALSE(d.has_named("missing"));
+
+	REQUIRE(d.getptr_named("position"));
+	CHECK(*d.getptr_named("position") == Variant(1));
+	CHECK(*d.getptr_named("velocity") == Variant(2));
+	CHECK(*d.getptr_named(StringName()) == Variant(3));
+	CHECK(d.getptr_named("missing") == nullptr);
+
+	// Lookups with a StringName Variant find String keys, including the empty one.
+	CHECK(d.has(StringName("position")));
+	CHECK(d.has(StringName()));
+	CHECK(*d.getptr(StringName("velocity")) == Variant(2));
+
+	d[StringName("position")] = 5;
+	CHECK(d.size() == 4);
+	CHECK(d["position"] == Variant(5));
+
+	bool valid = false;
+	CHECK(Variant(d).get_named("velocity", valid) == Variant(2));
+	CHECK(valid);
+
+	d.make_read_only();
+	CHECK(*d.getptr_named("position") == Variant(5));
+	CHECK(d[StringName("missing")] == Variant());
+	CHECK(d.size() == 4);
+}
+
 } // namespace TestDictionary
 
 #endif // TEST_DICTIONARY_H
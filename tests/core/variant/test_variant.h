@@ -126,6 +126,44 @@ TEST_CASE("[Variant] Writer and parser Variant::FLOAT") {
 	CHECK_MESSAGE(float_parsed == 1.0e+100, "Should match the double literal.");
 }
 
+TEST_CASE("[Variant] Parser strings") {
+	String errs;
+	int line = 0;
+	Variant parsed;
+
+	VariantParser::StreamString short_ss;
+	short_ss.s = "\"short\"";
+	VariantParser::parse(&short_ss, parsed, errs, line);
+	CHECK(parsed.get_type() == Variant::STRING);
+	CHECK(parsed == Variant("short"));
+
+	// Longer than the parser's inline buffer.
+	const String long_string = String("0123456789").repeat(20);
+	VariantParser::StreamString long_ss;
+	long_ss.s = "\"" + long_string + "\"";
+	VariantParser::parse(&long_ss, parsed, errs, line);
+	CHECK(parsed == Variant(long_string));
+
+	VariantParser::StreamString escaped_ss;
+	escaped_ss.s = "\"tab\\tquote\\\"pair\\ud83d\\ude00\"";
+	VariantParser::parse(&escaped_ss, parsed, errs, line);
+	CHECK(parsed == Variant(String(U"tab\tquote\"pair\U0001F600")));
+
+	VariantParser::StreamString string_name_ss;
+	string_name_ss.s = "&\"name\"";
+	VariantParser::parse(&string_name_ss, parsed, errs, line);
+	CHECK(parsed.get_type() == Variant::STRING_NAME);
+	CHECK(parsed == Variant(StringName("name")));
+
+	VariantParser::StreamString assign_ss;
+	assign_ss.s = "some_property = 42";
+	VariantParser::Tag tag;
+	String assign;
+	CHECK(VariantParser::parse_tag_assign_eof(&assign_ss, line, errs, tag, assign, parsed) == OK);
+	CHECK(assign == "some_property");
+	CHECK(parsed == Variant(42));
+}
+
 TEST_CASE("[Variant] Assignment To Bool from Int,Float,String,Vec2,Vec2i,Vec3,Vec3i and Color") {
 	Variant int_v = 0;
 	Variant bool_v = true;
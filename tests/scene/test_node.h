@@ -478,6 +478,111 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 	memdelete(node2);
 }
 
+TEST_CASE("[Node] Children order is kept when adding and removing many children") {
+	Node *parent = memnew(Node);
+	Node *front = memnew(Node);
+	Node *back = memnew(Node);
+	parent->add_child(front, false, Node::INTERNAL_MODE_FRONT);
+	parent->add_child(back, false, Node::INTERNAL_MODE_BACK);
+
+	const int child_count = 100;
+	LocalVector<Node *> children;
+	for (int i = 0; i < child_count; i++) {
+		Node *child = memnew(Node);
+		parent->add_child(child);
+		children.push_back(child);
+	}
+
+	// Remove every other child, with no queries in between.
+	for (int i = child_count - 2; i >= 0; i -= 2) {
+		parent->remove_child(children[i]);
+		memdelete(children[i]);
+		children.remove_at(i);
+	}
+
+	// Adding while there are removed children must keep the order too.
+	Node *front_2 = memnew(Node);
+	parent->add_child(front_2, false, Node::INTERNAL_MODE_FRONT);
+	Node *last = memnew(Node);
+	parent->add_child(last);
+	children.push_back(last);
+
+	CHECK_EQ(parent->get_child_count(false), (int)children.size());
+	CHECK_EQ(parent->get_child_count(), (int)children.size() + 3);
+	CHECK_EQ(parent->get_child(0), front);
+	CHECK_EQ(parent->get_child(1), front_2);
+	CHECK_EQ(parent->get_child(-1), back);
+	CHECK_EQ(back->get_index(), (int)children.size() + 2);
+	for (uint32_t i = 0; i < children.size(); i++) {
+		CHECK_EQ(parent->get_child(i, false), children[i]);
+		CHECK_EQ(children[i]->get_index(false), (int)i);
+		CHECK_EQ(children[i]->get_index(), (int)i + 2);
+	}
+
+	// Moving only affects the children in between.
+	parent->move_child(last, 0);
+	CHECK_EQ(parent->get_child(2), last);
+	CHECK_EQ(children[0]->get_index(false), 1);
+	parent->move_child(last, -1);
+	CHECK_EQ(last->get_index(false), (int)children.size() - 1);
+	CHECK_EQ(children[0]->get_index(false), 0);
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Freeing many nodes at once") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	const int child_count = 100;
+	LocalVector<TestNode *> children;
+	for (int i = 0; i < child_count; i++) {
+		TestNode *child = memnew(TestNode);
+		child->add_to_group("test_group");
+		child->set_process(true);
+		parent->add_child(child);
+		children.push_back(child);
+	}
+
+	for (int i = 0; i < child_count; i += 2) {
+		children[i]->queue_free();
+	}
+
+	SIGNAL_WATCH(SceneTree::get_singleton(), "tree_changed");
+	SceneTree::get_singleton()->process(0);
+
+	// The signal is emitted only once for all the nodes removed.
+	Array empty_signal_args;
+	empty_signal_args.push_back(Array());
+	SIGNAL_CHECK("tree_changed", empty_signal_args);
+	SIGNAL_UNWATCH(SceneTree::get_singleton(), "tree_changed");
+
+	List<Node *> group_nodes;
+	SceneTree::get_singleton()->get_nodes_in_group("test_group", &group_nodes);
+	CHECK_EQ(group_nodes.size(), child_count / 2);
+	int index = 1;
+	for (Node *n : group_nodes) {
+		CHECK_EQ(n, children[index]);
+		index += 2;
+	}
+
+	// Removed nodes are no longer processed, but the rest are.
+	SceneTree::get_singleton()->process(0);
+	for (int i = 1; i < child_count; i += 2) {
+		CHECK_EQ(children[i]->process_counter, 2);
+	}
+
+	// Removing and adding again the same node must work too.
+	parent->remove_child(children[1]);
+	parent->add_child(children[1]);
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(children[1]->process_counter, 3);
+	CHECK(children[1]->is_in_group("test_group"));
+
+	memdelete(parent);
+	CHECK_FALSE(SceneTree::get_singleton()->has_group("test_group"));
+}
+
 TEST_CASE("[Node] Processing checks") {
 	Node *node = memnew(Node);
 
@@ -762,6 +867,53 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test automatic partitioning of thread groups") {
+	Node *group = memnew(Node);
+	group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	group->set_process_thread_group_auto_partition(true);
+	SceneTree::get_singleton()->get_root()->add_child(group);
+
+	// Siblings of the same class are partitioned, together with their children.
+	const int agent_count = 16;
+	TestNode *agents[agent_count];
+	TestNode *agent_children[agent_count];
+	for (int i = 0; i < agent_count; i++) {
+		agents[i] = memnew(TestNode);
+		agent_children[i] = memnew(TestNode);
+		agents[i]->add_child(agent_children[i]);
+		group->add_child(agents[i]);
+		agents[i]->set_process(true);
+		agents[i]->set_physics_process(true);
+		agent_children[i]->set_process(true);
+	}
+
+	// A child with a unique class is not partitioned.
+	Node *other = memnew(Node);
+	TestNode *other_child = memnew(TestNode);
+	other->add_child(other_child);
+	group->add_child(other);
+	other_child->set_process(true);
+
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	// Removing nodes must update the partitions.
+	memdelete(agents[agent_count - 1]);
+
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	for (int i = 0; i < agent_count - 1; i++) {
+		CHECK_EQ(2, agents[i]->process_counter);
+		CHECK_EQ(2, agents[i]->physics_process_counter);
+		CHECK_EQ(2, agent_children[i]->process_counter);
+		CHECK_EQ(0, agent_children[i]->physics_process_counter);
+	}
+	CHECK_EQ(2, other_child->process_counter);
+
+	memdelete(group);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  test_timer.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TIMER_H
+#define TEST_TIMER_H
+
+#include "scene/main/timer.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTimer {
+
+static int timeout_count = 0;
+
+static void count_timeout() {
+	timeout_count++;
+}
+
+TEST_CASE("[SceneTree][Timer] Timers time out, in batches or one by one") {
+	const int timer_count = 100;
+	Timer *timers[timer_count];
+	timeout_count = 0;
+
+	for (int i = 0; i < timer_count; i++) {
+		timers[i] = memnew(Timer);
+		timers[i]->set_wait_time(1.0);
+		timers[i]->set_one_shot(i % 2 == 0);
+		if (i % 4 == 0) {
+			// Nodes with a custom priority are processed one by one.
+			timers[i]->set_process_priority(1);
+		}
+		if (i % 3 == 0) {
+			timers[i]->set_timer_process_callback(Timer::TIMER_PROCESS_PHYSICS);
+		}
+		timers[i]->connect("timeout", callable_mp_static(&count_timeout));
+		SceneTree::get_singleton()->get_root()->add_child(timers[i]);
+		timers[i]->start();
+	}
+
+	SceneTree::get_singleton()->process(0.6);
+	SceneTree::get_singleton()->physics_process(0.6);
+	CHECK_EQ(timeout_count, 0);
+	for (int i = 0; i < timer_count; i++) {
+		CHECK(timers[i]->get_time_left() == doctest::Approx(0.4));
+	}
+
+	SceneTree::get_singleton()->process(0.6);
+	SceneTree::get_singleton()->physics_process(0.6);
+	CHECK_EQ(timeout_count, timer_count);
+	for (int i = 0; i < timer_count; i++) {
+		if (timers[i]->is_one_shot()) {
+			CHECK(timers[i]->is_stopped());
+		} else {
+			CHECK(timers[i]->get_time_left() == doctest::Approx(0.8));
+		}
+	}
+
+	// Stopped timers no longer time out.
+	SceneTree::get_singleton()->process(1.0);
+	SceneTree::get_singleton()->physics_process(1.0);
+	CHECK_EQ(timeout_count, timer_count + timer_count / 2);
+
+	for (int i = 0; i < timer_count; i++) {
+		memdelete(timers[i]);
+	}
+}
+
+TEST_CASE("[SceneTree][Timer] Paused timers are skipped") {
+	Timer *timer = memnew(Timer);
+	SceneTree::get_singleton()->get_root()->add_child(timer);
+	timer->start(1.0);
+	timer->set_paused(true);
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(timer->get_time_left() == doctest::Approx(1.0));
+
+	timer->set_paused(false);
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(timer->get_time_left() == doctest::Approx(0.5));
+
+	memdelete(timer);
+}
+
+static Timer *timer_to_stop = nullptr;
+
+static void stop_other_timer() {
+	timeout_count++;
+	if (timer_to_stop) {
+		timer_to_stop->stop();
+	}
+}
+
+TEST_CASE("[SceneTree][Timer] Timers stopped by a previous timeout in the same batch don't time out") {
+	Timer *first = memnew(Timer);
+	Timer *second = memnew(Timer);
+	SceneTree::get_singleton()->get_root()->add_child(first);
+	SceneTree::get_singleton()->get_root()->add_child(second);
+	timeout_count = 0;
+	timer_to_stop = second;
+	first->connect("timeout", callable_mp_static(&stop_other_timer));
+	second->connect("timeout", callable_mp_static(&count_timeout));
+	first->start(1.0);
+	second->start(1.0);
+
+	SceneTree::get_singleton()->process(1.5);
+	CHECK_EQ(timeout_count, 1);
+	CHECK(second->is_stopped());
+
+	timer_to_stop = nullptr;
+	memdelete(first);
+	memdelete(second);
+}
+
+} // namespace TestTimer
+
+#endif // TEST_TIMER_H